@@ -1,4 +1,6 @@
+#include <zephyr/kernel.h>
 #include <lvgl.h>
+#include "../widgets/raster.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -240,4 +242,174 @@ const lv_img_dsc_t profiles = {
     .header.h = 3,
     .data_size = 20,
     .data = profiles_map,
-};
\ No newline at end of file
+};
+
+/**
+ * Canvas copies
+ *
+ * The same bitmaps stored the way the packed section canvases are laid out, one
+ * row per image column, with the colors of the selected theme baked in. They
+ * are drawn with raster_blit() without any palette lookup.
+ **/
+
+const uint8_t bolt_canvas_map[] = {
+#if CONFIG_NICE_VIEW_WIDGET_INVERTED
+    0x88, 0x00, 0x4c, 0x00, 0x2a, 0x00, 0x19, 0x00, 0x08, 0x80,
+#else
+    0x77, 0x80, 0xb3, 0x80, 0xd5, 0x80, 0xe6, 0x80, 0xf7, 0x00,
+#endif
+};
+
+const struct raster_img bolt_canvas = {
+    .w = 5,
+    .h = 9,
+    .data = bolt_canvas_map,
+};
+
+const uint8_t bt_canvas_map[] = {
+#if CONFIG_NICE_VIEW_WIDGET_INVERTED
+    0xff, 0xfe, 0xff, 0xfe, 0xe7, 0xce, 0xf3, 0x9e, 0xf9, 0x3e, 0x00, 0x00, 0x9c, 0x72, 0xc9,
+    0x26, 0xe3, 0x8e, 0xf7, 0xde, 0xff, 0xfe, 0xff, 0xfe,
+#else
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x0c, 0x60, 0x06, 0xc0, 0xff, 0xfe, 0x63, 0x8c, 0x36,
+    0xd8, 0x1c, 0x70, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00,
+#endif
+};
+
+const struct raster_img bt_canvas = {
+    .w = 12,
+    .h = 15,
+    .data = bt_canvas_map,
+};
+
+const uint8_t bt_no_signal_canvas_map[] = {
+#if CONFIG_NICE_VIEW_WIDGET_INVERTED
+    0xff, 0xf2, 0xff, 0xe6, 0xe7, 0xce, 0xf3, 0x9e, 0xfb, 0x3e, 0x06, 0x60, 0x9c, 0xf2, 0xd9,
+    0xa6, 0xf3, 0x8e, 0xe7, 0xde, 0xcf, 0xfe, 0x9f, 0xfe,
+#else
+    0x00, 0x0c, 0x00, 0x18, 0x18, 0x30, 0x0c, 0x60, 0x04, 0xc0, 0xf9, 0x9e, 0x63, 0x0c, 0x26,
+    0x58, 0x0c, 0x70, 0x18, 0x20, 0x30, 0x00, 0x60, 0x00,
+#endif
+};
+
+const struct raster_img bt_no_signal_canvas = {
+    .w = 12,
+    .h = 15,
+    .data = bt_no_signal_canvas_map,
+};
+
+const uint8_t bt_unbonded_canvas_map[] = {
+#if CONFIG_NICE_VIEW_WIDGET_INVERTED
+    0xfc, 0x7e, 0xf3, 0x9e, 0xef, 0xee, 0xfc, 0x7e, 0xfb, 0xbe, 0xff, 0xfe, 0xfe, 0xfe, 0xe7,
+    0xce, 0xf3, 0x9e, 0xf9, 0x3e, 0x00, 0x00, 0x9c, 0x72, 0xc9, 0x26, 0xe3, 0x8e, 0xf7, 0xde,
+    0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xbe, 0xfc, 0x7e, 0xef, 0xee, 0xf3, 0x9e, 0xfc, 0x7e,
+#else
+    0x03, 0x80, 0x0c, 0x60, 0x10, 0x10, 0x03, 0x80, 0x04, 0x40, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x30, 0x0c, 0x60, 0x06, 0xc0, 0xff, 0xfe, 0x63, 0x8c, 0x36, 0xd8, 0x1c, 0x70, 0x08, 0x20,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x40, 0x03, 0x80, 0x10, 0x10, 0x0c, 0x60, 0x03, 0x80,
+#endif
+};
+
+const struct raster_img bt_unbonded_canvas = {
+    .w = 22,
+    .h = 15,
+    .data = bt_unbonded_canvas_map,
+};
+
+const uint8_t usb_canvas_map[] = {
+#if CONFIG_NICE_VIEW_WIDGET_INVERTED
+    0xf1, 0xe0, 0xf1, 0xe0, 0xf1, 0xe0, 0xfb, 0xe0, 0xfb, 0xe0, 0xf8, 0xe0, 0xfa, 0x60, 0xfb,
+    0x20, 0xe3, 0xa0, 0xcb, 0x00, 0x9b, 0x00, 0xbb, 0xa0, 0x1b, 0xe0, 0x1b, 0xe0, 0x1b, 0xe0,
+    0xfb, 0xe0, 0xfb, 0xe0, 0xe0, 0xe0, 0xf1, 0xe0, 0xfb, 0xe0,
+#else
+    0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x04, 0x00, 0x07, 0x00, 0x05, 0x80, 0x04,
+    0xc0, 0x1c, 0x40, 0x34, 0xe0, 0x64, 0xe0, 0x44, 0x40, 0xe4, 0x00, 0xe4, 0x00, 0xe4, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x0e, 0x00, 0x04, 0x00,
+#endif
+};
+
+const struct raster_img usb_canvas = {
+    .w = 20,
+    .h = 11,
+    .data = usb_canvas_map,
+};
+
+const uint8_t gauge_canvas_map[] = {
+#if CONFIG_NICE_VIEW_WIDGET_INVERTED
+    0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x44, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x09,
+    0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x80, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x40, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x40, 0x02, 0x00, 0x07,
+    0x00, 0x07, 0x80, 0x0f, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x7c, 0x00,
+    0xf8, 0x00, 0x70, 0x00, 0x20, 0x00,
+#else
+    0xdf, 0xc0, 0xff, 0xc0, 0x7f, 0xc0, 0xbb, 0xc0, 0xdf, 0xc0, 0xdf, 0xc0, 0xef, 0xc0, 0xf6,
+    0xc0, 0xf7, 0xc0, 0xfb, 0xc0, 0xfb, 0xc0, 0xfb, 0x40, 0xfb, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0,
+    0xfd, 0xc0, 0xfd, 0x80, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0x80, 0xfd, 0xc0, 0xf8,
+    0xc0, 0xf8, 0x40, 0xf0, 0xc0, 0xf0, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0, 0xc3, 0xc0, 0x83, 0xc0,
+    0x07, 0xc0, 0x8f, 0xc0, 0xdf, 0xc0,
+#endif
+};
+
+const struct raster_img gauge_canvas = {
+    .w = 33,
+    .h = 10,
+    .data = gauge_canvas_map,
+};
+
+const uint8_t grid_canvas_map[] = {
+#if CONFIG_NICE_VIEW_WIDGET_INVERTED
+    0xaa, 0xa5, 0x54, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa5, 0x54, 0xaa, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa5, 0x54, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0xa5, 0x54, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa5, 0x54, 0xaa, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa5, 0x54, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0xa5, 0x54, 0xaa, 0x80,
+#else
+    0x55, 0x5a, 0xab, 0x55, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0x55, 0x5a, 0xab, 0x55, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x55, 0x5a, 0xab, 0x55, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x55, 0x5a, 0xab, 0x55, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0x55, 0x5a, 0xab, 0x55, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x55, 0x5a, 0xab, 0x55, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7f, 0xdf, 0xfb, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x55, 0x5a, 0xab, 0x55, 0x00,
+#endif
+};
+
+const struct raster_img grid_canvas = {
+    .w = 67,
+    .h = 33,
+    .data = grid_canvas_map,
+};
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <lvgl.h>
+#include "../widgets/raster.h"
+
+/**
+ * Pomodoro countdown digits
+ *
+ * A 9x14 monospaced digit set drawn as 1-bit masks, so the countdown can be
+ * updated one cell at a time. Generated in canvas order like the canvas copies
+ * in images.c: one row per glyph column, starting with its bottom pixel.
+ **/
+
+static const uint8_t digit_0_map[] = {
+    0x3f, 0xf0, 0x7f, 0xf8, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c,
+    0xc0, 0x0c, 0x7f, 0xf8, 0x3f, 0xf0,
+};
+
+static const uint8_t digit_1_map[] = {
+    0x00, 0x00, 0xc0, 0x20, 0xc0, 0x30, 0xc0, 0x18, 0xff, 0xfc, 0xff, 0xfc,
+    0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t digit_2_map[] = {
+    0xe0, 0x10, 0xf0, 0x18, 0xd8, 0x0c, 0xcc, 0x0c, 0xc6, 0x0c, 0xc3, 0x0c,
+    0xc1, 0x8c, 0xc0, 0xf8, 0xc0, 0x70,
+};
+
+static const uint8_t digit_3_map[] = {
+    0x20, 0x10, 0x60, 0x18, 0xc0, 0x0c, 0xc0, 0x0c, 0xc1, 0x0c, 0xc3, 0x8c,
+    0xc3, 0x8c, 0x7e, 0xf8, 0x3c, 0x70,
+};
+
+static const uint8_t digit_4_map[] = {
+    0x07, 0x80, 0x07, 0xc0, 0x06, 0x60, 0x06, 0x30, 0x06, 0x18, 0x06, 0x0c,
+    0xff, 0xfc, 0xff, 0xfc, 0x06, 0x00,
+};
+
+static const uint8_t digit_5_map[] = {
+    0x21, 0xfc, 0x61, 0xfc, 0xc1, 0x8c, 0xc1, 0x8c, 0xc1, 0x8c, 0xc1, 0x8c,
+    0xc1, 0x8c, 0x7f, 0x0c, 0x3e, 0x0c,
+};
+
+static const uint8_t digit_6_map[] = {
+    0x3f, 0xe0, 0x7f, 0xf0, 0xc1, 0x18, 0xc1, 0x8c, 0xc1, 0x84, 0xc1, 0x84,
+    0xc1, 0x84, 0x7f, 0x00, 0x3f, 0x00,
+};
+
+static const uint8_t digit_7_map[] = {
+    0x00, 0x0c, 0x00, 0x0c, 0xe0, 0x0c, 0xf8, 0x0c, 0x1e, 0x0c, 0x07, 0x8c,
+    0x01, 0xec, 0x00, 0x7c, 0x00, 0x1c,
+};
+
+static const uint8_t digit_8_map[] = {
+    0x3c, 0x70, 0x7e, 0xf8, 0xc3, 0x8c, 0xc3, 0x0c, 0xc3, 0x0c, 0xc3, 0x0c,
+    0xc3, 0x8c, 0x7e, 0xf8, 0x3c, 0x70,
+};
+
+static const uint8_t digit_9_map[] = {
+    0x01, 0xf0, 0x01, 0xf8, 0x83, 0x0c, 0x83, 0x0c, 0xc3, 0x0c, 0x63, 0x0c,
+    0x31, 0x0c, 0x1f, 0xf8, 0x0f, 0xf0,
+};
+
+static const uint8_t colon_map[] = {
+    0x18, 0x60, 0x18, 0x60,
+};
+
+const struct raster_img pomodoro_digits[] = {
+    {.w = 9, .h = 14, .data = digit_0_map},
+    {.w = 9, .h = 14, .data = digit_1_map},
+    {.w = 9, .h = 14, .data = digit_2_map},
+    {.w = 9, .h = 14, .data = digit_3_map},
+    {.w = 9, .h = 14, .data = digit_4_map},
+    {.w = 9, .h = 14, .data = digit_5_map},
+    {.w = 9, .h = 14, .data = digit_6_map},
+    {.w = 9, .h = 14, .data = digit_7_map},
+    {.w = 9, .h = 14, .data = digit_8_map},
+    {.w = 9, .h = 14, .data = digit_9_map},
+    {.w = 2, .h = 14, .data = colon_map},
+};
@@ -6,6 +6,11 @@
 #else
 #include "widgets/screen_peripheral.h"
 #endif
+#include "widgets/draw_bench.h"
+#include "widgets/frame_check.h"
+#include "widgets/latency.h"
+#include "widgets/line_flush.h"
+#include "widgets/panel_flush.h"
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
@@ -18,12 +23,32 @@ static struct zmk_widget_screen screen_widget;
 
 lv_obj_t *zmk_display_status_screen() {
     lv_obj_t *screen;
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DRAW_BENCH)
+    draw_bench_run();
+#endif
     screen = lv_obj_create(NULL);
 
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_LINE_FLUSH)
+    line_flush_init();
+#endif
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_TRACING) || IS_ENABLED(CONFIG_NICE_VIEW_GEM_RENDER_STATS)
+    panel_flush_init();
+#endif
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_LATENCY)
+    latency_init();
+#endif
+
 #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STATUS)
     zmk_widget_screen_init(&screen_widget, screen);
     lv_obj_align(zmk_widget_screen_obj(&screen_widget), LV_ALIGN_TOP_LEFT, 0, 0);
 #endif
 
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_FRAME_CHECK)
+    frame_check_start();
+#endif
+
     return screen;
 }
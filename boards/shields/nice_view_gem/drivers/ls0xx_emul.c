@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#define DT_DRV_COMPAT zmk_ls0xx_emul
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/logging/log.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cmdline.h"
+#include "soc.h"
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "ls0xx_emul.h"
+#include "ls0xx_emul_bottom.h"
+
+// Traffic of the sharp,ls0xx driver: a write command and a trailing byte per
+// write, an address and a dummy byte around the data of every line
+#define WRITE_OVERHEAD_BYTES 2
+#define LINE_OVERHEAD_BYTES 2
+
+#define REGION_LOG_SIZE CONFIG_NICE_VIEW_GEM_LS0XX_EMUL_REGION_LOG
+
+struct ls0xx_emul_config {
+    uint16_t width;
+    uint16_t height;
+};
+
+struct ls0xx_emul_data {
+    uint8_t *frame;
+    // Scratch for PBM dumps, same size as frame
+    uint8_t *pbm;
+    struct ls0xx_emul_stats stats;
+    struct ls0xx_emul_region regions[REGION_LOG_SIZE];
+};
+
+// Host directory that gets a PBM after every write, from --ls0xx-dump-dir
+static char *dump_dir;
+
+static void ls0xx_emul_options(void) {
+    static struct args_struct_t options[] = {
+        {.option = "ls0xx-dump-dir",
+         .name = "path",
+         .type = 's',
+         .dest = (void *)&dump_dir,
+         .descript = "Dump the emulated nice!view panel as a PBM file into this directory "
+                     "after every write"},
+        ARG_TABLE_ENDMARKER,
+    };
+
+    native_add_command_line_opts(options);
+}
+
+NATIVE_TASK(ls0xx_emul_options, PRE_BOOT_1, 1);
+
+static size_t frame_size(const struct ls0xx_emul_config *config) {
+    return config->width / 8 * config->height;
+}
+
+/** Display API **/
+
+static int ls0xx_emul_write(const struct device *dev, const uint16_t x, const uint16_t y,
+                            const struct display_buffer_descriptor *desc, const void *buf) {
+    const struct ls0xx_emul_config *config = dev->config;
+    struct ls0xx_emul_data *data = dev->data;
+    size_t line_bytes = config->width / 8;
+
+    // Same limits as the real driver: the panel is written in whole lines
+    if (x != 0 || desc->width != config->width || desc->pitch != desc->width) {
+        LOG_ERR("Writes must span whole lines, got x %u width %u", x, desc->width);
+        return -ENOTSUP;
+    }
+    if (y + desc->height > config->height || desc->buf_size < desc->height * line_bytes) {
+        LOG_ERR("Write of lines %u to %u is out of bounds", y, y + desc->height - 1);
+        return -EINVAL;
+    }
+
+    memcpy(data->frame + y * line_bytes, buf, desc->height * line_bytes);
+
+    uint32_t write = data->stats.writes++;
+    data->regions[write % REGION_LOG_SIZE] = (struct ls0xx_emul_region){
+        .write = write,
+        .first_line = y,
+        .lines = desc->height,
+    };
+    data->stats.lines += desc->height;
+    data->stats.spi_bytes +=
+        WRITE_OVERHEAD_BYTES + desc->height * (line_bytes + LINE_OVERHEAD_BYTES);
+
+    LOG_DBG("Write %u: lines %u to %u", write, y, y + desc->height - 1);
+
+    if (dump_dir != NULL) {
+        char path[256];
+
+        snprintf(path, sizeof(path), "%s/%s_%05u.pbm", dump_dir, dev->name, write);
+        ls0xx_emul_dump_pbm(dev, path);
+    }
+
+    return 0;
+}
+
+static int ls0xx_emul_blanking_on(const struct device *dev) { return 0; }
+
+static int ls0xx_emul_blanking_off(const struct device *dev) { return 0; }
+
+static int ls0xx_emul_read(const struct device *dev, const uint16_t x, const uint16_t y,
+                           const struct display_buffer_descriptor *desc, void *buf) {
+    return -ENOTSUP;
+}
+
+static void *ls0xx_emul_get_framebuffer(const struct device *dev) { return NULL; }
+
+static int ls0xx_emul_set_brightness(const struct device *dev, const uint8_t brightness) {
+    return -ENOTSUP;
+}
+
+static int ls0xx_emul_set_contrast(const struct device *dev, uint8_t contrast) {
+    return -ENOTSUP;
+}
+
+static void ls0xx_emul_get_capabilities(const struct device *dev,
+                                        struct display_capabilities *caps) {
+    const struct ls0xx_emul_config *config = dev->config;
+
+    memset(caps, 0, sizeof(*caps));
+    caps->x_resolution = config->width;
+    caps->y_resolution = config->height;
+    caps->supported_pixel_formats = PIXEL_FORMAT_MONO01;
+    caps->current_pixel_format = PIXEL_FORMAT_MONO01;
+    caps->screen_info = SCREEN_INFO_X_ALIGNMENT_WIDTH;
+    caps->current_orientation = DISPLAY_ORIENTATION_NORMAL;
+}
+
+static int ls0xx_emul_set_pixel_format(const struct device *dev,
+                                       const enum display_pixel_format pf) {
+    return pf == PIXEL_FORMAT_MONO01 ? 0 : -ENOTSUP;
+}
+
+static int ls0xx_emul_set_orientation(const struct device *dev,
+                                      const enum display_orientation orientation) {
+    return orientation == DISPLAY_ORIENTATION_NORMAL ? 0 : -ENOTSUP;
+}
+
+static const struct display_driver_api ls0xx_emul_api = {
+    .blanking_on = ls0xx_emul_blanking_on,
+    .blanking_off = ls0xx_emul_blanking_off,
+    .write = ls0xx_emul_write,
+    .read = ls0xx_emul_read,
+    .get_framebuffer = ls0xx_emul_get_framebuffer,
+    .set_brightness = ls0xx_emul_set_brightness,
+    .set_contrast = ls0xx_emul_set_contrast,
+    .get_capabilities = ls0xx_emul_get_capabilities,
+    .set_pixel_format = ls0xx_emul_set_pixel_format,
+    .set_orientation = ls0xx_emul_set_orientation,
+};
+
+/** Inspection **/
+
+void ls0xx_emul_get_stats(const struct device *dev, struct ls0xx_emul_stats *stats) {
+    const struct ls0xx_emul_data *data = dev->data;
+
+    *stats = data->stats;
+}
+
+void ls0xx_emul_reset_stats(const struct device *dev) {
+    struct ls0xx_emul_data *data = dev->data;
+
+    memset(&data->stats, 0, sizeof(data->stats));
+}
+
+size_t ls0xx_emul_get_regions(const struct device *dev, struct ls0xx_emul_region *regions,
+                              size_t max) {
+    const struct ls0xx_emul_data *data = dev->data;
+    size_t count = MIN(MIN(data->stats.writes, REGION_LOG_SIZE), max);
+    uint32_t first = data->stats.writes - count;
+
+    for (size_t i = 0; i < count; i++) {
+        regions[i] = data->regions[(first + i) % REGION_LOG_SIZE];
+    }
+    return count;
+}
+
+const uint8_t *ls0xx_emul_get_frame(const struct device *dev) {
+    const struct ls0xx_emul_data *data = dev->data;
+
+    return data->frame;
+}
+
+void ls0xx_emul_get_pbm(const struct device *dev, uint8_t *pbm_rows) {
+    const struct ls0xx_emul_config *config = dev->config;
+    const struct ls0xx_emul_data *data = dev->data;
+
+    // The panel takes the leftmost pixel in the LSB with 1 for white
+    for (size_t i = 0; i < frame_size(config); i++) {
+        uint8_t b = ~data->frame[i];
+
+        b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+        b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+        b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+        pbm_rows[i] = b;
+    }
+}
+
+int ls0xx_emul_dump_pbm(const struct device *dev, const char *path) {
+    const struct ls0xx_emul_config *config = dev->config;
+    struct ls0xx_emul_data *data = dev->data;
+
+    ls0xx_emul_get_pbm(dev, data->pbm);
+    if (ls0xx_emul_bottom_write_pbm(path, config->width, config->height, data->pbm) < 0) {
+        LOG_ERR("Could not write %s", path);
+        return -EIO;
+    }
+    return 0;
+}
+
+/** Initialization **/
+
+static int ls0xx_emul_init(const struct device *dev) {
+    const struct ls0xx_emul_config *config = dev->config;
+    struct ls0xx_emul_data *data = dev->data;
+
+    // The real driver clears the panel to white on init
+    memset(data->frame, 0xFF, frame_size(config));
+    return 0;
+}
+
+#define LS0XX_EMUL_INIT(n)                                                                         \
+    static uint8_t ls0xx_emul_frame_##n[DT_INST_PROP(n, width) / 8 * DT_INST_PROP(n, height)];    \
+    static uint8_t ls0xx_emul_pbm_##n[sizeof(ls0xx_emul_frame_##n)];                               \
+                                                                                                   \
+    static const struct ls0xx_emul_config ls0xx_emul_config_##n = {                               \
+        .width = DT_INST_PROP(n, width),                                                           \
+        .height = DT_INST_PROP(n, height),                                                         \
+    };                                                                                             \
+                                                                                                   \
+    static struct ls0xx_emul_data ls0xx_emul_data_##n = {                                          \
+        .frame = ls0xx_emul_frame_##n,                                                             \
+        .pbm = ls0xx_emul_pbm_##n,                                                                 \
+    };                                                                                             \
+                                                                                                   \
+    DEVICE_DT_INST_DEFINE(n, ls0xx_emul_init, NULL, &ls0xx_emul_data_##n,                          \
+                          &ls0xx_emul_config_##n, POST_KERNEL, CONFIG_DISPLAY_INIT_PRIORITY,       \
+                          &ls0xx_emul_api);
+
+DT_INST_FOREACH_STATUS_OKAY(LS0XX_EMUL_INIT)
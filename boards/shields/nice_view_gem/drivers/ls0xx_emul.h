@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/device.h>
+
+// Line range received by one display_write()
+struct ls0xx_emul_region {
+    uint32_t write;
+    uint16_t first_line;
+    uint16_t lines;
+};
+
+struct ls0xx_emul_stats {
+    // display_write() calls, each one chip-select burst on a real panel
+    uint32_t writes;
+    uint32_t lines;
+    // Bytes a real panel would clock in, including commands and addresses
+    uint32_t spi_bytes;
+};
+
+void ls0xx_emul_get_stats(const struct device *dev, struct ls0xx_emul_stats *stats);
+void ls0xx_emul_reset_stats(const struct device *dev);
+
+// Most recent regions, oldest first. Returns how many were copied to regions.
+size_t ls0xx_emul_get_regions(const struct device *dev, struct ls0xx_emul_region *regions,
+                              size_t max);
+
+// Panel memory: height lines of width / 8 bytes, in the sharp,ls0xx wire format
+const uint8_t *ls0xx_emul_get_frame(const struct device *dev);
+
+// Panel contents as PBM rows: leftmost pixel in the MSB, 1 for black
+void ls0xx_emul_get_pbm(const struct device *dev, uint8_t *pbm_rows);
+
+// Write the panel contents as a binary PBM file on the host
+int ls0xx_emul_dump_pbm(const struct device *dev, const char *path);
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+#include "ls0xx_emul_bottom.h"
+
+int ls0xx_emul_bottom_write_pbm(const char *path, int width, int height, const uint8_t *pbm_rows) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+
+    size_t size = (size_t)(width + 7) / 8 * height;
+    fprintf(f, "P4\n%d %d\n", width, height);
+    int ret = fwrite(pbm_rows, 1, size, f) == size ? 0 : -1;
+
+    fclose(f);
+    return ret;
+}
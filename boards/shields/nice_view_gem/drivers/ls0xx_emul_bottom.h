@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// Host side of the emulated panel, built into the native simulator runner
+
+#include <stdint.h>
+
+// Write a width x height frame as a binary PBM. pbm_rows is already in PBM bit order.
+int ls0xx_emul_bottom_write_pbm(const char *path, int width, int height, const uint8_t *pbm_rows);
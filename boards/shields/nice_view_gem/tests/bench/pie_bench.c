@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Host microbenchmark of the pomodoro pie fill.
+ *
+ *   cc -O2 -o pie_bench pie_bench.c -lm && ./pie_bench
+ *
+ * "atan2" is the old draw_pie_segment(): every pixel of the radius-21 disc
+ * computes its angle and is drawn as its own 1x1 rectangle. "angle_map" looks
+ * the angle up in the table pomodoro_init() builds, only computes it for pixels
+ * in the same table step as the end of the segment, and draws each column as
+ * runs. canvas_draw_rect() and raster_vline() are modeled as a plain fill of
+ * the 1-bit canvas, so LVGL's per-call overhead, which favours the span
+ * version further, is left out. Both fills are compared pixel by pixel at
+ * every second of a session.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+
+#define BUFFER_SIZE 68
+#define ITERATIONS 20000
+
+#define CIRCLE_CENTER_X 34
+#define CIRCLE_CENTER_Y 38
+#define PIE_RADIUS 21
+#define PIE_SIZE (2 * PIE_RADIUS + 1)
+#define PIE_ANGLE_STEPS 254
+#define PIE_OUTSIDE 0xFF
+
+// One bit per pixel, rows of BUFFER_SIZE bits like the LV_IMG_CF_INDEXED_1BIT canvas
+#define STRIDE ((BUFFER_SIZE + 7) / 8)
+
+static uint8_t canvas[BUFFER_SIZE * STRIDE];
+static uint8_t pie_angle[PIE_SIZE][PIE_SIZE];
+
+__attribute__((noinline)) static void canvas_draw_rect(int x, int y, int w, int h) {
+    for (int row = y; row < y + h; row++) {
+        for (int col = x; col < x + w; col++) {
+            canvas[row * STRIDE + col / 8] |= 0x80 >> (col % 8);
+        }
+    }
+}
+
+static float pie_pixel_angle(int px, int py) {
+    float angle = atan2((float)px, (float)(-py));
+    if (angle < 0)
+        angle += 2.0f * 3.14159265f;
+    return angle;
+}
+
+static uint8_t pie_step(float angle) {
+    return (uint8_t)(angle * PIE_ANGLE_STEPS / (2.0f * 3.14159265f));
+}
+
+static void build_pie_angle_map(void) {
+    for (int px = -PIE_RADIUS; px <= PIE_RADIUS; px++) {
+        for (int py = -PIE_RADIUS; py <= PIE_RADIUS; py++) {
+            uint8_t *cell = &pie_angle[px + PIE_RADIUS][py + PIE_RADIUS];
+            if (px * px + py * py > PIE_RADIUS * PIE_RADIUS) {
+                *cell = PIE_OUTSIDE;
+                continue;
+            }
+            *cell = pie_step(pie_pixel_angle(px, py));
+        }
+    }
+}
+
+static void fill_atan2(int elapsed, int duration) {
+    float progress = (float)elapsed / (float)duration;
+    if (progress <= 0.0f)
+        return;
+    if (progress > 1.0f)
+        progress = 1.0f;
+
+    float end_angle = progress * 2.0f * 3.14159265f;
+    for (int py = -PIE_RADIUS; py <= PIE_RADIUS; py++) {
+        for (int px = -PIE_RADIUS; px <= PIE_RADIUS; px++) {
+            if (px * px + py * py > PIE_RADIUS * PIE_RADIUS)
+                continue;
+
+            float angle = atan2((float)px, (float)(-py));
+            if (angle < 0)
+                angle += 2.0f * 3.14159265f;
+            if (angle <= end_angle) {
+                canvas_draw_rect(CIRCLE_CENTER_X + px, CIRCLE_CENTER_Y + py, 1, 1);
+            }
+        }
+    }
+}
+
+static bool pie_covers(int x, int y, uint8_t end_step, float end_angle) {
+    uint8_t step = pie_angle[x][y];
+    if (step != end_step) {
+        return step < end_step;
+    }
+    return pie_pixel_angle(x - PIE_RADIUS, y - PIE_RADIUS) <= end_angle;
+}
+
+static void fill_angle_map(int elapsed, int duration) {
+    if (elapsed <= 0)
+        return;
+    float progress = (float)elapsed / (float)duration;
+    if (progress > 1.0f)
+        progress = 1.0f;
+
+    float end_angle = progress * 2.0f * 3.14159265f;
+    uint8_t end_step = pie_step(end_angle);
+    for (int x = 0; x < PIE_SIZE; x++) {
+        int y = 0;
+        while (y < PIE_SIZE) {
+            if (!pie_covers(x, y, end_step, end_angle)) {
+                y++;
+                continue;
+            }
+            int start = y;
+            while (y < PIE_SIZE && pie_covers(x, y, end_step, end_angle)) {
+                y++;
+            }
+            canvas_draw_rect(CIRCLE_CENTER_X - PIE_RADIUS + x, CIRCLE_CENTER_Y - PIE_RADIUS + start,
+                             1, y - start);
+        }
+    }
+}
+
+static int popcount_diff(const uint8_t *a, const uint8_t *b) {
+    int diff = 0;
+    for (int i = 0; i < BUFFER_SIZE * STRIDE; i++) {
+        diff += __builtin_popcount(a[i] ^ b[i]);
+    }
+    return diff;
+}
+
+// Worst pixel mismatch between both fills over a whole session
+static int check_session(int duration) {
+    static uint8_t expected[BUFFER_SIZE * STRIDE];
+    int worst = 0;
+
+    for (int elapsed = 0; elapsed <= duration; elapsed++) {
+        memset(canvas, 0, sizeof(canvas));
+        fill_atan2(elapsed, duration);
+        memcpy(expected, canvas, sizeof(canvas));
+
+        memset(canvas, 0, sizeof(canvas));
+        fill_angle_map(elapsed, duration);
+
+        int diff = popcount_diff(expected, canvas);
+        if (diff > worst)
+            worst = diff;
+    }
+    return worst;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static void run(const char *name, void (*fill)(int, int), int percent) {
+    const int duration = 25 * 60;
+    const int elapsed = duration * percent / 100;
+
+#ifdef HAVE_RDTSC
+    uint64_t cycles = __rdtsc();
+#endif
+    uint64_t start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++) {
+        memset(canvas, 0, sizeof(canvas));
+        fill(elapsed, duration);
+        __asm__ volatile("" : : "r"(canvas) : "memory");
+    }
+    uint64_t ns = (now_ns() - start) / ITERATIONS;
+#ifdef HAVE_RDTSC
+    cycles = (__rdtsc() - cycles) / ITERATIONS;
+#else
+    uint64_t cycles = 0;
+#endif
+
+    printf("pie=%s progress=%d%% ns_per_op=%llu cycles_per_op=%llu\n", name, percent,
+           (unsigned long long)ns, (unsigned long long)cycles);
+}
+
+int main(void) {
+    build_pie_angle_map();
+
+    // Break, default work and longer work sessions, in seconds
+    static const int durations[] = {5 * 60, 25 * 60, 30 * 60, 90 * 60};
+    for (size_t i = 0; i < sizeof(durations) / sizeof(durations[0]); i++) {
+        printf("check duration=%ds max_pixel_diff=%d\n", durations[i],
+               check_session(durations[i]));
+    }
+
+    static const int progress[] = {25, 47, 100};
+    for (size_t i = 0; i < sizeof(progress) / sizeof(progress[0]); i++) {
+        run("atan2", fill_atan2, progress[i]);
+        run("angle_map", fill_angle_map, progress[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Host microbenchmark of the 68x68 section rotation.
+ *
+ *   cc -O2 -o rotate_bench rotate_bench.c && ./rotate_bench
+ *
+ * "transform" is the old rotate_canvas(): a copy of the lv_color_t buffer, a
+ * background fill and LVGL's per-pixel affine resampler at 90 degrees. LVGL is
+ * not part of this tree, so its inner loops (lv_draw_sw_transform with
+ * antialiasing off and lv_img_buf_set_px_color) are modeled here in plain C.
+ * "transpose" is the packed 8x8 bit-matrix kernel that briefly replaced it,
+ * checked against a naive clockwise rotation. It is kept here as a copy
+ * because it is no longer in the firmware: sections are drawn in landscape
+ * directly and do not rotate at all. On the host it is no faster than the
+ * modeled transform on busy content, so it is a record of a dropped
+ * approach, not of a shipped gain.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+
+#define BUFFER_SIZE 68
+#define ITERATIONS 20000
+
+#define DIV_ROUND_UP(n, d) (((n) + (d) - 1) / (d))
+
+// LV_COLOR_DEPTH 1: one byte per pixel, only the lowest bit is used
+typedef struct {
+    uint8_t full;
+} lv_color_t;
+
+static lv_color_t canvas[BUFFER_SIZE * BUFFER_SIZE];
+
+/**
+ * Before: memcpy + lv_canvas_transform(canvas, &img, 900, ...)
+ **/
+
+#define TRIGO_SHIFT 15
+#define CF_TRUE_COLOR 4
+
+static lv_color_t transform_tmp[BUFFER_SIZE * BUFFER_SIZE];
+
+// lv_img_buf_set_px_color(), called once per covered pixel
+__attribute__((noinline)) static void set_px_color(lv_color_t *buf, int cf, int w, int x, int y,
+                                                   lv_color_t c) {
+    switch (cf) {
+    case CF_TRUE_COLOR:
+        memcpy(&buf[w * y + x], &c, sizeof(c));
+        break;
+    default:
+        break;
+    }
+}
+
+// One row of lv_draw_sw_transform(): map every destination pixel back into the source
+__attribute__((noinline)) static void transform_row(int y, const lv_color_t *src, int32_t sinma,
+                                                    int32_t cosma, int32_t pivot_x,
+                                                    int32_t pivot_y, lv_color_t *cbuf,
+                                                    uint8_t *abuf) {
+    for (int x = 0; x < BUFFER_SIZE; x++) {
+        int32_t xt = x - pivot_x;
+        int32_t yt = y - pivot_y;
+        // Upscaled by 256 like LVGL, to keep sub-pixel precision for antialiasing
+        int32_t xs = ((cosma * xt + sinma * yt) >> (TRIGO_SHIFT - 8)) + (pivot_x << 8);
+        int32_t ys = ((-sinma * xt + cosma * yt) >> (TRIGO_SHIFT - 8)) + (pivot_y << 8);
+        int32_t xs_int = xs >> 8;
+        int32_t ys_int = ys >> 8;
+
+        if (xs_int < 0 || xs_int >= BUFFER_SIZE || ys_int < 0 || ys_int >= BUFFER_SIZE) {
+            abuf[x] = 0;
+            continue;
+        }
+        cbuf[x] = src[ys_int * BUFFER_SIZE + xs_int];
+        abuf[x] = 0xff;
+    }
+}
+
+static void rotate_transform(lv_color_t *cbuf) {
+    static lv_color_t row_color[BUFFER_SIZE];
+    static uint8_t row_opa[BUFFER_SIZE];
+    // lv_trigo_sin(90) and lv_trigo_sin(180)
+    const int32_t sinma = 32767, cosma = 0;
+
+    memcpy(transform_tmp, cbuf, sizeof(transform_tmp));
+    memset(cbuf, 0, sizeof(transform_tmp));
+
+    for (int y = 0; y < BUFFER_SIZE; y++) {
+        transform_row(y, transform_tmp, sinma, cosma, BUFFER_SIZE / 2, BUFFER_SIZE / 2, row_color,
+                      row_opa);
+        for (int x = 0; x < BUFFER_SIZE; x++) {
+            if (row_opa[x]) {
+                set_px_color(cbuf, CF_TRUE_COLOR, BUFFER_SIZE, x, y, row_color[x]);
+            }
+        }
+    }
+}
+
+/**
+ * After: packed 8x8 bit-matrix transpose, as rotate_canvas() had it
+ **/
+
+#define ROTATE_BLOCKS DIV_ROUND_UP(BUFFER_SIZE, 8)
+
+static uint8_t rotate_bits[ROTATE_BLOCKS * 8][ROTATE_BLOCKS];
+
+static inline void transpose8_load(const uint8_t *p, uint32_t *x, uint32_t *y) {
+    *x = ((uint32_t)p[0] << 24) | ((uint32_t)p[ROTATE_BLOCKS] << 16) |
+         ((uint32_t)p[2 * ROTATE_BLOCKS] << 8) | p[3 * ROTATE_BLOCKS];
+    *y = ((uint32_t)p[4 * ROTATE_BLOCKS] << 24) | ((uint32_t)p[5 * ROTATE_BLOCKS] << 16) |
+         ((uint32_t)p[6 * ROTATE_BLOCKS] << 8) | p[7 * ROTATE_BLOCKS];
+}
+
+static inline void transpose8_store(uint8_t *p, uint32_t x, uint32_t y) {
+    p[0] = x >> 24;
+    p[ROTATE_BLOCKS] = x >> 16;
+    p[2 * ROTATE_BLOCKS] = x >> 8;
+    p[3 * ROTATE_BLOCKS] = x;
+    p[4 * ROTATE_BLOCKS] = y >> 24;
+    p[5 * ROTATE_BLOCKS] = y >> 16;
+    p[6 * ROTATE_BLOCKS] = y >> 8;
+    p[7 * ROTATE_BLOCKS] = y;
+}
+
+// 8x8 bit-matrix transpose (Hacker's Delight, transpose8rS32)
+static inline void transpose8(uint32_t *x, uint32_t *y) {
+    uint32_t t;
+
+    t = (*x ^ (*x >> 7)) & 0x00AA00AA;
+    *x = *x ^ t ^ (t << 7);
+    t = (*y ^ (*y >> 7)) & 0x00AA00AA;
+    *y = *y ^ t ^ (t << 7);
+
+    t = (*x ^ (*x >> 14)) & 0x0000CCCC;
+    *x = *x ^ t ^ (t << 14);
+    t = (*y ^ (*y >> 14)) & 0x0000CCCC;
+    *y = *y ^ t ^ (t << 14);
+
+    t = (*x & 0xF0F0F0F0) | ((*y >> 4) & 0x0F0F0F0F);
+    *y = ((*x << 4) & 0xF0F0F0F0) | (*y & 0x0F0F0F0F);
+    *x = t;
+}
+
+static void rotate_transpose(lv_color_t *cbuf) {
+    memset(rotate_bits, 0, sizeof(rotate_bits));
+
+    // Pack bottom row first so that the transpose turns clockwise
+    for (int y = 0; y < BUFFER_SIZE; y++) {
+        const lv_color_t *src = &cbuf[(BUFFER_SIZE - 1 - y) * BUFFER_SIZE];
+        uint8_t *row = rotate_bits[y];
+        for (int x = 0; x < BUFFER_SIZE; x++) {
+            if (src[x].full) {
+                row[x >> 3] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+
+    for (int i = 0; i < ROTATE_BLOCKS; i++) {
+        uint32_t ax, ay, bx, by;
+
+        transpose8_load(&rotate_bits[i * 8][i], &ax, &ay);
+        transpose8(&ax, &ay);
+        transpose8_store(&rotate_bits[i * 8][i], ax, ay);
+
+        // Swap mirrored blocks around the diagonal
+        for (int j = i + 1; j < ROTATE_BLOCKS; j++) {
+            transpose8_load(&rotate_bits[i * 8][j], &ax, &ay);
+            transpose8_load(&rotate_bits[j * 8][i], &bx, &by);
+            transpose8(&ax, &ay);
+            transpose8(&bx, &by);
+            transpose8_store(&rotate_bits[j * 8][i], ax, ay);
+            transpose8_store(&rotate_bits[i * 8][j], bx, by);
+        }
+    }
+
+    for (int y = 0; y < BUFFER_SIZE; y++) {
+        const uint8_t *row = rotate_bits[y];
+        lv_color_t *dst = &cbuf[y * BUFFER_SIZE];
+        for (int x = 0; x < BUFFER_SIZE; x++) {
+            dst[x].full = (row[x >> 3] >> (7 - (x & 7))) & 1;
+        }
+    }
+}
+
+/**
+ * Harness
+ **/
+
+static void fill_random(lv_color_t *buf) {
+    for (int i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        buf[i].full = rand() & 1;
+    }
+}
+
+// Mostly background with a few solid shapes and a row of text-like strokes, like a section
+static void fill_section(lv_color_t *buf) {
+    memset(buf, 0, BUFFER_SIZE * BUFFER_SIZE * sizeof(lv_color_t));
+    for (int y = 4; y < 14; y++) {
+        for (int x = 40; x < 64; x++) {
+            buf[y * BUFFER_SIZE + x].full = y == 4 || y == 13 || x == 40 || x == 63 || x < 52;
+        }
+    }
+    for (int y = 40; y < 58; y++) {
+        for (int x = 6; x < 62; x++) {
+            buf[y * BUFFER_SIZE + x].full = (x % 11) < 2 || y == 40 || y == 57;
+        }
+    }
+}
+
+// Clockwise quarter turn, one pixel at a time
+static int check_transpose(void) {
+    static lv_color_t src[BUFFER_SIZE * BUFFER_SIZE];
+
+    fill_random(canvas);
+    memcpy(src, canvas, sizeof(src));
+    rotate_transpose(canvas);
+
+    for (int y = 0; y < BUFFER_SIZE; y++) {
+        for (int x = 0; x < BUFFER_SIZE; x++) {
+            const lv_color_t *expected = &src[(BUFFER_SIZE - 1 - x) * BUFFER_SIZE + y];
+            if (canvas[y * BUFFER_SIZE + x].full != expected->full) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static void run(const char *name, const char *fixture, void (*fill)(lv_color_t *),
+                void (*rotate)(lv_color_t *)) {
+    fill(canvas);
+
+    // Warm up caches and branch predictors
+    for (int i = 0; i < ITERATIONS / 10; i++) {
+        rotate(canvas);
+    }
+
+    uint64_t start = now_ns();
+#ifdef HAVE_RDTSC
+    uint64_t start_tsc = __rdtsc();
+#endif
+    for (int i = 0; i < ITERATIONS; i++) {
+        rotate(canvas);
+    }
+#ifdef HAVE_RDTSC
+    uint64_t cycles = (__rdtsc() - start_tsc) / ITERATIONS;
+#else
+    uint64_t cycles = 0;
+#endif
+    uint64_t ns = (now_ns() - start) / ITERATIONS;
+
+    printf("rotate=%s fixture=%s ns_per_op=%llu cycles_per_op=%llu\n", name, fixture,
+           (unsigned long long)ns, (unsigned long long)cycles);
+}
+
+int main(void) {
+    srand(1);
+    if (check_transpose() < 0) {
+        printf("rotate=transpose FAIL: not a clockwise quarter turn\n");
+        return 1;
+    }
+
+    run("transform", "section", fill_section, rotate_transform);
+    run("transpose", "section", fill_section, rotate_transpose);
+    run("transform", "random", fill_random, rotate_transform);
+    run("transpose", "random", fill_random, rotate_transpose);
+    return 0;
+}
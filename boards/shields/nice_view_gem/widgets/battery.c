@@ -1,8 +1,9 @@
 #include <zephyr/kernel.h>
 #include "battery.h"
+#include "raster.h"
 #include "../assets/custom_fonts.h"
 
-LV_IMG_DECLARE(bolt);
+RASTER_IMG_DECLARE(bolt_canvas);
 
 static void draw_level(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_label_dsc_t label_right_dsc;
@@ -11,27 +12,27 @@ static void draw_level(lv_obj_t *canvas, const struct status_state *state) {
     char text[10] = {};
 
     sprintf(text, "%i%%", state->battery);
-    lv_canvas_draw_text(canvas, 26, 19, 42, &label_right_dsc, text);
+    canvas_draw_text(canvas, 26, 19, 42, &label_right_dsc, text);
 }
 
 static void draw_charging_level(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
     lv_draw_label_dsc_t label_right_dsc;
     init_label_dsc(&label_right_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_RIGHT);
 
     char text[10] = {};
 
     sprintf(text, "%i%%", state->battery);
-    lv_canvas_draw_text(canvas, 26, 19, 35, &label_right_dsc, text);
-    lv_canvas_draw_img(canvas, 62, 21, &bolt, &img_dsc);
+    canvas_draw_text(canvas, 26, 19, 35, &label_right_dsc, text);
+    raster_blit(lv_canvas_get_img(canvas), 62, 21, &bolt_canvas);
 }
 
-void draw_battery_status(lv_obj_t *canvas, const struct status_state *state) {
+void draw_battery_static(lv_obj_t *canvas) {
     lv_draw_label_dsc_t label_left_dsc;
     init_label_dsc(&label_left_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 19, 25, &label_left_dsc, "BAT");
+    canvas_draw_text(canvas, 0, 19, 25, &label_left_dsc, "BAT");
+}
 
+void draw_battery_status(lv_obj_t *canvas, const struct status_state *state) {
     if (state->charging) {
         draw_charging_level(canvas, state);
     } else {
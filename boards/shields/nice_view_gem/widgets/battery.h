@@ -10,4 +10,6 @@ struct battery_status_state {
 #endif
 };
 
+// Label drawn once into the static layer
+void draw_battery_static(lv_obj_t *canvas);
 void draw_battery_status(lv_obj_t *canvas, const struct status_state *state);
@@ -17,6 +17,7 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
 #include "pomodoro.h"
+#include "render_stats.h"
 #include "screen.h"
 #endif
 
@@ -25,8 +26,10 @@ static int behavior_pom_sub_time_init(const struct device *dev) { return 0; }
 static int on_keymap_binding_pressed(struct zmk_behavior_binding *binding,
                                       struct zmk_behavior_binding_event event) {
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+    uint32_t start = k_cycle_get_32();
     pomodoro_sub_time();
-    zmk_widget_screen_refresh();
+    zmk_widget_screen_refresh(&gem_screen_pomodoro);
+    render_stats_behavior_press(start);
 #endif
     return ZMK_BEHAVIOR_OPAQUE;
 }
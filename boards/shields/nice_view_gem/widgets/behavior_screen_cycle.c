@@ -18,6 +18,7 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 // Screen cycling now works on central (left) display
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+#include "render_stats.h"
 #include "screen.h"
 #endif
 
@@ -26,7 +27,9 @@ static int behavior_screen_cycle_init(const struct device *dev) { return 0; }
 static int on_keymap_binding_pressed(struct zmk_behavior_binding *binding,
                                       struct zmk_behavior_binding_event event) {
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+    uint32_t start = k_cycle_get_32();
     zmk_widget_screen_cycle();
+    render_stats_behavior_press(start);
 #endif
     return ZMK_BEHAVIOR_OPAQUE;
 }
@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// Host clock for native_sim measurements, built into the native simulator runner
+
+#include <stdint.h>
+
+// Host monotonic clock. Simulated time stands still while code runs, so it cannot time draws.
+uint64_t clock_bottom_now_ns(void);
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+#include "battery.h"
+#include "draw_bench.h"
+#include "heap_stats.h"
+#include "output.h"
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+#include "layer.h"
+#include "pomodoro.h"
+#include "profile_viewer.h"
+#include "screen_selector.h"
+#include "stats_screen.h"
+#include "wpm.h"
+#endif
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+#include "clock_bottom.h"
+#endif
+
+#define BENCH_ITERATIONS CONFIG_NICE_VIEW_GEM_DRAW_BENCH_ITERATIONS
+
+/**
+ * Clock
+ **/
+
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+// Simulated time does not advance while code runs, so native_sim reads the host clock
+typedef uint64_t bench_time_t;
+
+static bench_time_t bench_now(void) { return clock_bottom_now_ns(); }
+
+static uint64_t bench_elapsed_ns(bench_time_t start, bench_time_t end) { return end - start; }
+#else
+typedef timing_t bench_time_t;
+
+static bench_time_t bench_now(void) { return timing_counter_get(); }
+
+static uint64_t bench_elapsed_ns(bench_time_t start, bench_time_t end) {
+    return timing_cycles_to_ns(timing_cycles_get(&start, &end));
+}
+#endif
+
+/**
+ * Fixtures and cases
+ **/
+
+struct bench_fixture {
+    const char *name;
+    struct status_state state;
+};
+
+struct bench_case {
+    const char *name;
+    lv_coord_t width;
+    void (*draw)(lv_obj_t *canvas, const struct status_state *state);
+};
+
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+static const struct bench_fixture fixtures[] = {
+    {
+        .name = "usb_charging",
+        .state = {.battery = 100,
+                  .charging = true,
+                  .selected_endpoint = {.transport = ZMK_TRANSPORT_USB},
+                  .profiles_bonded = {true},
+                  .layer_label = "BASE"},
+    },
+    {
+        .name = "ble_connected",
+        .state = {.battery = 57,
+                  .selected_endpoint = {.transport = ZMK_TRANSPORT_BLE},
+                  .active_profile_index = 1,
+                  .active_profile_connected = true,
+                  .active_profile_bonded = true,
+                  .profiles_connected = {false, true},
+                  .profiles_bonded = {true, true, true},
+                  .layer_index = 1,
+                  .layer_label = "lower",
+                  // Picking up speed after a pause, in a ring that has wrapped around
+                  .wpm = {.samples = {48, 63, 71, 55, 0, 12, 30, 44, 52, 60},
+                          .head = 4,
+                          .min = 0,
+                          .max = 71}},
+    },
+    {
+        .name = "ble_unbonded",
+        .state = {.battery = 8,
+                  .selected_endpoint = {.transport = ZMK_TRANSPORT_BLE},
+                  .active_profile_index = 4,
+                  .profiles_bonded = {true, true},
+                  .layer_index = 3},
+    },
+};
+#else
+static const struct bench_fixture fixtures[] = {
+    {.name = "connected", .state = {.battery = 80, .connected = true}},
+    {.name = "disconnected", .state = {.battery = 15, .charging = true}},
+};
+#endif
+
+static void bench_fill_background(lv_obj_t *canvas, const struct status_state *state) {
+    fill_background(canvas);
+}
+
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+static void bench_draw_screen_selector(lv_obj_t *canvas, const struct status_state *state) {
+    draw_screen_selector(canvas, 0);
+}
+
+static void bench_draw_pomodoro(lv_obj_t *canvas, const struct status_state *state) {
+    draw_pomodoro(canvas);
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_STATS_SCREEN)
+static void bench_draw_stats_screen(lv_obj_t *canvas, const struct status_state *state) {
+    draw_stats_screen(canvas);
+}
+#endif
+#endif
+
+static const struct bench_case cases[] = {
+    {"fill_background", BUFFER_SIZE, bench_fill_background},
+    {"draw_battery_status", EDGE_BUFFER_SIZE, draw_battery_status},
+    {"draw_output_status", EDGE_BUFFER_SIZE, draw_output_status},
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+    {"draw_layer_status", EDGE_BUFFER_SIZE, draw_layer_status},
+    {"draw_screen_selector", EDGE_BUFFER_SIZE, bench_draw_screen_selector},
+    {"draw_profile_viewer_status", BUFFER_SIZE, draw_profile_viewer_status},
+    {"draw_pomodoro", BUFFER_SIZE, bench_draw_pomodoro},
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_SCREEN)
+    {"draw_wpm_status", BUFFER_SIZE, draw_wpm_status},
+#endif
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_STATS_SCREEN)
+    {"draw_stats_screen", BUFFER_SIZE, bench_draw_stats_screen},
+#endif
+#endif
+};
+
+/**
+ * Runner
+ **/
+
+static uint8_t bench_cbuf[CANVAS_BUF_SIZE(BUFFER_SIZE, BUFFER_SIZE)];
+
+static void run_case(lv_obj_t *canvas, const struct bench_case *c,
+                     const struct bench_fixture *f) {
+    fill_background(canvas);
+    // Warm up, so caches such as the text sprites are measured in their steady state
+    c->draw(canvas, &f->state);
+
+    struct heap_stats before, after;
+    heap_stats_reset_peak();
+    heap_stats_get(&before);
+
+    bench_time_t start = bench_now();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        c->draw(canvas, &f->state);
+    }
+    bench_time_t end = bench_now();
+
+    heap_stats_get(&after);
+
+    printk("draw_bench: %-26s %-14s ns/op=%u allocs=%u peak_heap=%u\n", c->name, f->name,
+           (uint32_t)(bench_elapsed_ns(start, end) / BENCH_ITERATIONS),
+           after.allocs - before.allocs, (uint32_t)(after.peak - before.used));
+}
+
+void draw_bench_run(void) {
+#if !IS_ENABLED(CONFIG_ARCH_POSIX)
+    timing_init();
+    timing_start();
+#endif
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+    // Builds the pie angle map; the status screen resets the timer again later
+    pomodoro_init();
+#endif
+
+    lv_obj_t *canvas = lv_canvas_create(lv_scr_act());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+
+    printk("draw_bench: begin iterations=%u\n", BENCH_ITERATIONS);
+    for (int i = 0; i < ARRAY_SIZE(cases); i++) {
+        init_canvas(canvas, bench_cbuf, cases[i].width, BUFFER_SIZE);
+        for (int j = 0; j < ARRAY_SIZE(fixtures); j++) {
+            run_case(canvas, &cases[i], &fixtures[j]);
+        }
+    }
+    printk("draw_bench: end\n");
+
+    lv_obj_del(canvas);
+#if !IS_ENABLED(CONFIG_ARCH_POSIX)
+    timing_stop();
+#endif
+}
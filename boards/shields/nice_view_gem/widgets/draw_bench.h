@@ -0,0 +1,11 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// Run every section draw function over a set of status fixtures on an
+// off-screen canvas and print one line per function and fixture. Called from
+// the display work queue before the status screen is built.
+void draw_bench_run(void);
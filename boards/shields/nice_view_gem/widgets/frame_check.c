@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/logging/log.h>
+#include <zmk/display.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cmdline.h"
+#include "posix_board_if.h"
+#include "soc.h"
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "../drivers/ls0xx_emul.h"
+#include "clock_bottom.h"
+#include "frame_check.h"
+#include "frame_check_bottom.h"
+#include "render.h"
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+#include "pomodoro.h"
+#include "profile_viewer.h"
+#include "screen.h"
+#include "wpm.h"
+#define FRAME_CHECK_ROLE "central"
+#else
+#include "screen_peripheral.h"
+#define FRAME_CHECK_ROLE "peripheral"
+#endif
+
+#define DISPLAY_NODE DT_CHOSEN(zephyr_display)
+#define PANEL_WIDTH DT_PROP(DISPLAY_NODE, width)
+#define PANEL_HEIGHT DT_PROP(DISPLAY_NODE, height)
+#define PANEL_PBM_SIZE (PANEL_WIDTH / 8 * PANEL_HEIGHT)
+
+// Host timing jitter allowed on top of the percentage margin
+#define FRAME_TIME_SLACK_US 500
+
+static const struct device *display = DEVICE_DT_GET(DISPLAY_NODE);
+
+// Golden image directory, with one subdirectory per role, and record mode.
+// The directory defaults to the one checked in with the shield.
+static char *golden_dir = FRAME_CHECK_GOLDEN_DIR;
+static bool record;
+
+static void frame_check_options(void) {
+    static struct args_struct_t options[] = {
+        {.option = "frame-check-dir",
+         .name = "path",
+         .type = 's',
+         .dest = (void *)&golden_dir,
+         .descript = "Directory with the golden frames of the nice!view frame check, "
+                     "instead of the one in the shield's tests/golden"},
+        {.is_switch = true,
+         .option = "frame-check-record",
+         .type = 'b',
+         .dest = (void *)&record,
+         .descript = "Write the golden frames and budgets instead of checking them"},
+        ARG_TABLE_ENDMARKER,
+    };
+
+    native_add_command_line_opts(options);
+}
+
+NATIVE_TASK(frame_check_options, PRE_BOOT_1, 1);
+
+/**
+ * Script
+ **/
+
+struct frame_check_step {
+    const char *name;
+    // Simulated seconds to let pass before the step, for the pomodoro timer
+    uint32_t wait_s;
+    // Runs on the display work queue right before the frame is drawn
+    void (*apply)(int arg);
+    int arg;
+};
+
+// Status shown by the script, changed one field at a time
+static struct status_state script_state = {.battery = 100};
+
+static void set_battery(int level) {
+    script_state.battery = level;
+    zmk_widget_screen_set_state(&script_state);
+}
+
+static void set_charging(int charging) {
+    script_state.charging = charging;
+    zmk_widget_screen_set_state(&script_state);
+}
+
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+#define BLE_CONNECTED BIT(3)
+#define BLE_BONDED BIT(4)
+#define BLE_PROFILE(arg) ((arg) & 0x7)
+
+static const char *const layer_labels[] = {"BASE", "lower", "Raise", "ADJUST"};
+
+static void set_usb(int arg) {
+    script_state.selected_endpoint.transport = ZMK_TRANSPORT_USB;
+    zmk_widget_screen_set_state(&script_state);
+}
+
+static void set_ble(int arg) {
+    int profile = BLE_PROFILE(arg);
+
+    script_state.selected_endpoint.transport = ZMK_TRANSPORT_BLE;
+    script_state.active_profile_index = profile;
+    script_state.active_profile_connected = arg & BLE_CONNECTED;
+    script_state.active_profile_bonded = arg & BLE_BONDED;
+    script_state.profiles_connected[profile] = arg & BLE_CONNECTED;
+    script_state.profiles_bonded[profile] = arg & BLE_BONDED;
+    zmk_widget_screen_set_state(&script_state);
+}
+
+static void set_layer(int index) {
+    script_state.layer_index = index;
+    script_state.layer_label = index < ARRAY_SIZE(layer_labels) ? layer_labels[index] : NULL;
+    zmk_widget_screen_set_state(&script_state);
+}
+
+// Screen shown by the script. Screens it has no steps for, such as the statistics
+// page, are cycled past without a frame.
+static int script_screen;
+
+static void cycle_to(const struct gem_screen *screen) {
+    while (script_screen != gem_screen_index(screen)) {
+        zmk_widget_screen_cycle();
+        script_screen = (script_screen + 1) % gem_screen_count();
+    }
+}
+
+static void show_profiles(int arg) { cycle_to(&gem_screen_profiles); }
+
+static void show_pomodoro(int arg) { cycle_to(&gem_screen_pomodoro); }
+
+static void pom_start_stop(int arg) {
+    pomodoro_start_stop();
+    zmk_widget_screen_refresh(&gem_screen_pomodoro);
+}
+
+static void pom_add_time(int arg) {
+    pomodoro_add_time();
+    zmk_widget_screen_refresh(&gem_screen_pomodoro);
+}
+
+static void pom_reset(int arg) {
+    pomodoro_reset();
+    zmk_widget_screen_refresh(&gem_screen_pomodoro);
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_SCREEN)
+static void show_wpm(int arg) { cycle_to(&gem_screen_wpm); }
+
+static void push_wpm(int wpm) {
+    wpm_history_push(&script_state.wpm, wpm);
+    zmk_widget_screen_set_state(&script_state);
+}
+#endif
+
+static const struct frame_check_step steps[] = {
+    {"initial", 0, set_battery, 100},
+    {"battery_42", 0, set_battery, 42},
+    {"battery_3", 0, set_battery, 3},
+    {"charging", 0, set_charging, true},
+    {"battery_100", 0, set_battery, 100},
+    {"not_charging", 0, set_charging, false},
+    {"usb", 0, set_usb},
+    {"ble_0_connected", 0, set_ble, 0 | BLE_BONDED | BLE_CONNECTED},
+    {"ble_1_disconnected", 0, set_ble, 1 | BLE_BONDED},
+    {"ble_2_unbonded", 0, set_ble, 2},
+    {"ble_3_connected", 0, set_ble, 3 | BLE_BONDED | BLE_CONNECTED},
+    {"ble_4_disconnected", 0, set_ble, 4 | BLE_BONDED},
+    {"layer_1", 0, set_layer, 1},
+    {"layer_2", 0, set_layer, 2},
+    {"layer_3", 0, set_layer, 3},
+    {"layer_7_unnamed", 0, set_layer, 7},
+    {"layer_0", 0, set_layer, 0},
+    {"pomodoro_idle", 0, show_pomodoro},
+    {"pomodoro_work_longer", 0, pom_add_time},
+    {"pomodoro_setup_break", 0, pom_start_stop},
+    {"pomodoro_running_work", 0, pom_start_stop},
+    // Waits stay clear of the 5% steps, so timer wakeups never race with the capture
+    {"pomodoro_work_38_percent", 690},
+    {"pomodoro_paused", 0, pom_start_stop},
+    {"pomodoro_resumed", 60, pom_start_stop},
+    {"pomodoro_running_break", 1222},
+    {"pomodoro_reset", 0, pom_reset},
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_SCREEN)
+    {"wpm_idle", 0, show_wpm},
+    {"wpm_first_sample", 0, push_wpm, 35},
+    {"wpm_rising", 0, push_wpm, 62},
+    {"wpm_peak", 0, push_wpm, 118},
+    {"wpm_falling", 0, push_wpm, 80},
+    {"wpm_stopped", 0, push_wpm, 0},
+#endif
+    {"profiles", 0, show_profiles},
+};
+#else
+static void set_connected(int connected) {
+    script_state.connected = connected;
+    zmk_widget_screen_set_state(&script_state);
+}
+
+static const struct frame_check_step steps[] = {
+    {"initial", 0, set_battery, 100},
+    {"connected", 0, set_connected, true},
+    {"battery_42", 0, set_battery, 42},
+    {"battery_3", 0, set_battery, 3},
+    {"charging", 0, set_charging, true},
+    {"battery_100", 0, set_battery, 100},
+    {"not_charging", 0, set_charging, false},
+    {"disconnected", 0, set_connected, false},
+};
+#endif
+
+/**
+ * Capture
+ *
+ * Steps are applied and drawn on the display work queue, like status updates,
+ * while the script thread sleeps between them.
+ **/
+
+static struct {
+    const struct frame_check_step *step;
+    struct frame_check_budget measured;
+} capture;
+
+static void capture_work_handler(struct k_work *work);
+K_WORK_DEFINE(capture_work, capture_work_handler);
+K_SEM_DEFINE(capture_done, 0, 1);
+
+static void capture_work_handler(struct k_work *work) {
+    struct ls0xx_emul_stats stats;
+
+    ls0xx_emul_reset_stats(display);
+    uint64_t start = clock_bottom_now_ns();
+
+    if (capture.step->apply != NULL) {
+        capture.step->apply(capture.step->arg);
+    }
+    render_now();
+    lv_refr_now(NULL);
+
+    capture.measured.frame_us = (clock_bottom_now_ns() - start) / 1000;
+    ls0xx_emul_get_stats(display, &stats);
+    capture.measured.flush_bytes = stats.spi_bytes;
+
+    k_sem_give(&capture_done);
+}
+
+static uint32_t count_pixel_diff(const uint8_t *a, const uint8_t *b) {
+    uint32_t diff = 0;
+    for (int i = 0; i < PANEL_PBM_SIZE; i++) {
+        diff += __builtin_popcount(a[i] ^ b[i]);
+    }
+    return diff;
+}
+
+// Returns true if the captured frame matches its golden image and budget
+static bool check_step(int index, const struct frame_check_step *step) {
+    static uint8_t frame[PANEL_PBM_SIZE];
+    static uint8_t golden[PANEL_PBM_SIZE];
+    const struct frame_check_budget *measured = &capture.measured;
+    struct frame_check_budget budget;
+    char path[256];
+
+    ls0xx_emul_get_pbm(display, frame);
+
+    snprintf(path, sizeof(path), "%s/%s/%02d_%s.pbm", golden_dir, FRAME_CHECK_ROLE, index,
+             step->name);
+
+    if (record) {
+        if (frame_check_bottom_write(path, PANEL_WIDTH, PANEL_HEIGHT, frame, measured) < 0) {
+            LOG_ERR("Could not write %s", path);
+            return false;
+        }
+        printk("frame_check: %-26s recorded flush_bytes=%u frame_us=%u\n", step->name,
+               measured->flush_bytes, measured->frame_us);
+        return true;
+    }
+
+    if (frame_check_bottom_read(path, PANEL_WIDTH, PANEL_HEIGHT, golden, &budget) < 0) {
+        LOG_ERR("Missing or invalid golden frame %s, record it with --frame-check-record",
+                path);
+        return false;
+    }
+
+    uint32_t pixels = count_pixel_diff(frame, golden);
+    bool ok = pixels == 0 && measured->flush_bytes <= budget.flush_bytes;
+
+    // Host time depends on the machine running the check, so it is only reported
+    // unless asked for
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_FRAME_CHECK_TIME)
+    uint32_t time_limit =
+        budget.frame_us * (100 + CONFIG_NICE_VIEW_GEM_FRAME_CHECK_TIME_MARGIN) / 100 +
+        FRAME_TIME_SLACK_US;
+    ok = ok && measured->frame_us <= time_limit;
+#else
+    uint32_t time_limit = budget.frame_us;
+#endif
+
+    printk("frame_check: %-26s %s pixels_differ=%u flush_bytes=%u/%u frame_us=%u/%u\n",
+           step->name, ok ? "ok" : "FAIL", pixels, measured->flush_bytes, budget.flush_bytes,
+           measured->frame_us, time_limit);
+    return ok;
+}
+
+/**
+ * Script thread
+ **/
+
+K_SEM_DEFINE(frame_check_ready, 0, 1);
+
+static void frame_check_main(void *p1, void *p2, void *p3) {
+    int failed = 0;
+
+    k_sem_take(&frame_check_ready, K_FOREVER);
+    printk("frame_check: begin %s steps=%u dir=%s\n", FRAME_CHECK_ROLE,
+           (uint32_t)ARRAY_SIZE(steps), golden_dir);
+
+    if (record) {
+        char dir[256];
+
+        snprintf(dir, sizeof(dir), "%s/%s", golden_dir, FRAME_CHECK_ROLE);
+        if (frame_check_bottom_make_dir(dir) < 0) {
+            LOG_ERR("Could not create %s", dir);
+            posix_exit(1);
+        }
+    }
+
+    for (int i = 0; i < ARRAY_SIZE(steps); i++) {
+        k_sleep(K_SECONDS(steps[i].wait_s));
+
+        capture.step = &steps[i];
+        k_work_submit_to_queue(zmk_display_work_q(), &capture_work);
+        k_sem_take(&capture_done, K_FOREVER);
+
+        if (!check_step(i, &steps[i])) {
+            failed++;
+        }
+    }
+
+    printk("frame_check: end failed=%d\n", failed);
+    posix_exit(failed > 0 ? 1 : 0);
+}
+
+K_THREAD_DEFINE(frame_check_thread, 2048, frame_check_main, NULL, NULL, NULL,
+                K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+void frame_check_start(void) { k_sem_give(&frame_check_ready); }
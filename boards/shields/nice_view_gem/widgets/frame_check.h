@@ -0,0 +1,10 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// Start driving the status screen through the frame check script. Called once
+// the screen is built.
+void frame_check_start(void);
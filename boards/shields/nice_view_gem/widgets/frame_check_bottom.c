@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include "frame_check_bottom.h"
+
+#define BUDGET_FORMAT "# budget flush_bytes=%u frame_us=%u\n"
+
+int frame_check_bottom_read(const char *path, int width, int height, uint8_t *pbm_rows,
+                            struct frame_check_budget *budget) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return -1;
+    }
+
+    int w, h;
+    size_t size = (size_t)(width + 7) / 8 * height;
+    int ret = -1;
+
+    // Exactly one newline separates the header from the pixel data
+    if (fscanf(f, "P4\n" BUDGET_FORMAT, &budget->flush_bytes, &budget->frame_us) == 2 &&
+        fscanf(f, "%d %d", &w, &h) == 2 && w == width && h == height && fgetc(f) == '\n' &&
+        fread(pbm_rows, 1, size, f) == size) {
+        ret = 0;
+    }
+
+    fclose(f);
+    return ret;
+}
+
+int frame_check_bottom_write(const char *path, int width, int height, const uint8_t *pbm_rows,
+                             const struct frame_check_budget *budget) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+
+    size_t size = (size_t)(width + 7) / 8 * height;
+    fprintf(f, "P4\n" BUDGET_FORMAT "%d %d\n", budget->flush_bytes, budget->frame_us, width,
+            height);
+    int ret = fwrite(pbm_rows, 1, size, f) == size ? 0 : -1;
+
+    fclose(f);
+    return ret;
+}
+
+int frame_check_bottom_make_dir(const char *path) {
+    if (mkdir(path, 0755) < 0 && errno != EEXIST) {
+        return -1;
+    }
+    return 0;
+}
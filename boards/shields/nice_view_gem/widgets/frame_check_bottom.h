@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// Host side of the frame check, built into the native simulator runner
+
+#include <stdint.h>
+
+// Budget recorded next to a golden frame, as a comment in its PBM header
+struct frame_check_budget {
+    uint32_t flush_bytes;
+    uint32_t frame_us;
+};
+
+// Read a width x height golden PBM and its budget. Returns -1 if the file is
+// missing or does not match the expected format.
+int frame_check_bottom_read(const char *path, int width, int height, uint8_t *pbm_rows,
+                            struct frame_check_budget *budget);
+
+int frame_check_bottom_write(const char *path, int width, int height, const uint8_t *pbm_rows,
+                             const struct frame_check_budget *budget);
+
+// Create a directory for recorded frames, if it does not exist yet
+int frame_check_bottom_make_dir(const char *path);
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+
+#include "heap_stats.h"
+
+// Every block is prefixed with its size so frees can be counted. Keeps the
+// 8 byte alignment of the LVGL heap.
+#define BLOCK_HEADER_SIZE 8
+
+void *__real_lvgl_malloc(size_t size);
+void *__real_lvgl_realloc(void *ptr, size_t size);
+void __real_lvgl_free(void *ptr);
+
+// Only touched from the display work queue, like the rest of LVGL
+static struct heap_stats heap;
+
+static void *block_data(void *block, size_t size) {
+    *(size_t *)block = size;
+    return (uint8_t *)block + BLOCK_HEADER_SIZE;
+}
+
+static void *block_of(void *ptr) { return (uint8_t *)ptr - BLOCK_HEADER_SIZE; }
+
+static void heap_grow(size_t size) {
+    heap.allocs++;
+    heap.used += size;
+    heap.peak = MAX(heap.peak, heap.used);
+}
+
+void *__wrap_lvgl_malloc(size_t size) {
+    void *block = __real_lvgl_malloc(size + BLOCK_HEADER_SIZE);
+    if (block == NULL) {
+        return NULL;
+    }
+
+    heap_grow(size);
+    return block_data(block, size);
+}
+
+void *__wrap_lvgl_realloc(void *ptr, size_t size) {
+    if (ptr == NULL) {
+        return __wrap_lvgl_malloc(size);
+    }
+
+    size_t old_size = *(size_t *)block_of(ptr);
+    void *block = __real_lvgl_realloc(block_of(ptr), size + BLOCK_HEADER_SIZE);
+    if (block == NULL) {
+        return NULL;
+    }
+
+    heap.used -= old_size;
+    heap_grow(size);
+    return block_data(block, size);
+}
+
+void __wrap_lvgl_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    heap.used -= *(size_t *)block_of(ptr);
+    __real_lvgl_free(block_of(ptr));
+}
+
+void heap_stats_get(struct heap_stats *stats) { *stats = heap; }
+
+void heap_stats_reset_peak(void) { heap.peak = heap.used; }
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+// LVGL heap use, counted by wrapping lvgl_malloc, lvgl_realloc and lvgl_free
+// at link time when CONFIG_NICE_VIEW_GEM_HEAP_STATS is set
+struct heap_stats {
+    uint32_t allocs;
+    size_t used;
+    size_t peak;
+};
+
+void heap_stats_get(struct heap_stats *stats);
+
+// Restart the peak from the current use
+void heap_stats_reset_peak(void);
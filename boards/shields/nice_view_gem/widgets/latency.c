@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+
+#if IS_ENABLED(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+#include "latency.h"
+#include "render.h"
+#include "render_stats.h"
+
+#define NUM_SECTIONS 3
+
+static const char *const section_names[NUM_SECTIONS] = {"top", "middle", "bottom"};
+
+// Per section, the oldest event not drawn yet and the oldest event drawn but not on the panel
+struct section_latency {
+    bool queued;
+    bool drawn;
+    uint32_t queued_cycles;
+    uint32_t drawn_cycles;
+};
+
+static struct k_spinlock lock;
+static struct section_latency sections_state[NUM_SECTIONS];
+static struct latency_histogram histograms[NUM_SECTIONS];
+
+static void (*panel_monitor_cb)(lv_disp_drv_t *drv, uint32_t time, uint32_t px);
+
+static int bucket_of(uint32_t us) {
+    int bucket = us > 1 ? 31 - __builtin_clz(us) : 0;
+    return MIN(bucket, LATENCY_BUCKETS - 1);
+}
+
+static void record(int section, uint32_t cycles) {
+    struct latency_histogram *hist = &histograms[section];
+    uint32_t us = k_cyc_to_us_floor32(cycles);
+
+    hist->count++;
+    hist->max_us = MAX(hist->max_us, us);
+    hist->buckets[bucket_of(us)]++;
+}
+
+void latency_event(uint8_t sections) {
+    uint32_t now = k_cycle_get_32();
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        if ((sections & BIT(i)) && !sections_state[i].queued) {
+            sections_state[i].queued = true;
+            sections_state[i].queued_cycles = now;
+        }
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+void latency_drawn(uint8_t sections) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        struct section_latency *state = &sections_state[i];
+
+        if ((sections & BIT(i)) && state->queued) {
+            // An older drawn event still waiting for the panel keeps its timestamp
+            if (!state->drawn) {
+                state->drawn = true;
+                state->drawn_cycles = state->queued_cycles;
+            }
+            state->queued = false;
+        }
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+void latency_rendered(uint8_t sections) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        if (sections & BIT(i)) {
+            sections_state[i].queued = false;
+        }
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+// Called by LVGL once a refresh has been flushed to the panel
+static void latency_monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+    uint32_t now = k_cycle_get_32();
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        if (sections_state[i].drawn) {
+            record(i, now - sections_state[i].drawn_cycles);
+            sections_state[i].drawn = false;
+        }
+    }
+
+    k_spin_unlock(&lock, key);
+
+    if (panel_monitor_cb != NULL) {
+        panel_monitor_cb(drv, time, px);
+    }
+}
+
+void latency_init(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+    if (disp == NULL || disp->driver->monitor_cb == latency_monitor_cb) {
+        return;
+    }
+
+    panel_monitor_cb = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = latency_monitor_cb;
+}
+
+void latency_get(int section, struct latency_histogram *hist) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    *hist = histograms[section];
+    k_spin_unlock(&lock, key);
+}
+
+void latency_reset(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    memset(histograms, 0, sizeof(histograms));
+    k_spin_unlock(&lock, key);
+}
+
+/**
+ * Log dump
+ **/
+
+#if CONFIG_NICE_VIEW_GEM_LATENCY_LOG_INTERVAL > 0
+#define LATENCY_LOG_INTERVAL K_SECONDS(CONFIG_NICE_VIEW_GEM_LATENCY_LOG_INTERVAL)
+
+static void latency_log(struct k_work *work);
+K_WORK_DELAYABLE_DEFINE(latency_work, latency_log);
+
+// Non-empty buckets as "<lower bound in us>:<count>" pairs
+static void format_buckets(const struct latency_histogram *hist, char *buf, size_t len) {
+    size_t pos = 0;
+
+    buf[0] = '\0';
+    for (int i = 0; i < LATENCY_BUCKETS && pos < len; i++) {
+        if (hist->buckets[i] > 0) {
+            pos += snprintf(buf + pos, len - pos, " %u:%u", i > 0 ? (uint32_t)BIT(i) : 0,
+                            hist->buckets[i]);
+        }
+    }
+}
+
+static void latency_log(struct k_work *work) {
+    struct latency_histogram hist;
+    char buf[LATENCY_BUCKETS * 16];
+
+    RENDER_STATS_INC(timer_wakeups);
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        latency_get(i, &hist);
+        if (hist.count == 0) {
+            continue;
+        }
+        format_buckets(&hist, buf, sizeof(buf));
+        LOG_INF("Latency %s: %u events, max %u us, us:count%s", section_names[i], hist.count,
+                hist.max_us, buf);
+    }
+
+    k_work_schedule(&latency_work, LATENCY_LOG_INTERVAL);
+}
+
+static int latency_log_init(void) {
+    k_work_schedule(&latency_work, LATENCY_LOG_INTERVAL);
+    return 0;
+}
+
+SYS_INIT(latency_log_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif
+
+/**
+ * Shell command
+ **/
+
+#if IS_ENABLED(CONFIG_SHELL)
+static int cmd_latency_show(const struct shell *sh, size_t argc, char **argv) {
+    struct latency_histogram hist;
+
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        latency_get(i, &hist);
+        shell_print(sh, "%s: %u events, max %u us", section_names[i], hist.count, hist.max_us);
+        for (int b = 0; b < LATENCY_BUCKETS; b++) {
+            if (hist.buckets[b] > 0) {
+                shell_print(sh, "  >= %7u us: %u", b > 0 ? (uint32_t)BIT(b) : 0, hist.buckets[b]);
+            }
+        }
+    }
+    return 0;
+}
+
+static int cmd_latency_reset(const struct shell *sh, size_t argc, char **argv) {
+    latency_reset();
+    shell_print(sh, "Latency histograms cleared");
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_gem_latency,
+                               SHELL_CMD(show, NULL, "Print the histograms", cmd_latency_show),
+                               SHELL_CMD(reset, NULL, "Clear the histograms", cmd_latency_reset),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(gem_latency, &sub_gem_latency, "Event to panel latency per display section",
+                   NULL);
+#endif
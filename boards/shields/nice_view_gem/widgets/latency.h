@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+// Event to panel latency histograms, only collected with CONFIG_NICE_VIEW_GEM_LATENCY.
+// Bucket i counts latencies of [2^i, 2^(i+1)) microseconds, the last one everything above.
+#define LATENCY_BUCKETS 21
+
+struct latency_histogram {
+    uint32_t count;
+    uint32_t max_us;
+    uint32_t buckets[LATENCY_BUCKETS];
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_LATENCY)
+// Hook the display refresh to close the measurements, once the display is up
+void latency_init(void);
+
+// A status event that changes the given sections entered a display listener
+void latency_event(uint8_t sections);
+
+// The given sections were drawn for the pending events
+void latency_drawn(uint8_t sections);
+
+// A render pass for the given sections is done; events of sections it did not draw had no
+// visible effect and are dropped
+void latency_rendered(uint8_t sections);
+
+// Copy the histogram of one section, by RENDER_SECTION_* bit index
+void latency_get(int section, struct latency_histogram *hist);
+
+void latency_reset(void);
+#else
+static inline void latency_event(uint8_t sections) {}
+static inline void latency_drawn(uint8_t sections) {}
+static inline void latency_rendered(uint8_t sections) {}
+#endif
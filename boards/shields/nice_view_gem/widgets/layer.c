@@ -19,5 +19,5 @@ void draw_layer_status(lv_obj_t *canvas, const struct status_state *state) {
     }
 
     // Draw centered in bottom canvas
-    lv_canvas_draw_text(canvas, 0, 20, 68, &label_dsc, text);
+    canvas_draw_text(canvas, 0, 20, 68, &label_dsc, text);
 }
\ No newline at end of file
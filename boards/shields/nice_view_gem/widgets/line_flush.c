@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "line_flush.h"
+#include "panel_flush.h"
+
+#define DISPLAY_NODE DT_CHOSEN(zephyr_display)
+
+// The sharp,ls0xx panel is written in whole lines along its long side
+#define PANEL_WIDTH DT_PROP(DISPLAY_NODE, width)
+#define PANEL_LINES DT_PROP(DISPLAY_NODE, height)
+#define LINE_BYTES (PANEL_WIDTH / 8)
+
+static const struct device *display = DEVICE_DT_GET(DISPLAY_NODE);
+
+// LVGL's own flush, kept for areas that do not span whole lines
+static void (*panel_flush_cb)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+
+// Last transmitted contents of each panel line
+static uint8_t shadow[PANEL_LINES][LINE_BYTES];
+static bool shadow_valid[PANEL_LINES];
+
+// Totals of the area being flushed
+static uint16_t area_lines;
+static uint16_t area_lines_skipped;
+static uint32_t area_bytes;
+
+static void write_lines(int first, int count, const uint8_t *buf) {
+    struct display_buffer_descriptor desc = {
+        .buf_size = count * LINE_BYTES,
+        .width = PANEL_WIDTH,
+        .height = count,
+        .pitch = PANEL_WIDTH,
+    };
+
+    display_write(display, 0, first, &desc, buf);
+
+    area_lines += count;
+    area_bytes += PANEL_WIRE_BYTES(count, LINE_BYTES);
+}
+
+static void line_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    if (area->x1 != 0 || area->x2 != PANEL_WIDTH - 1 || area->y1 < 0 ||
+        area->y2 >= PANEL_LINES) {
+        // Not rounded to whole lines: send as is and forget what those lines hold
+        for (int y = MAX(area->y1, 0); y <= MIN(area->y2, PANEL_LINES - 1); y++) {
+            shadow_valid[y] = false;
+        }
+        panel_flush_cb(drv, area, color_p);
+        return;
+    }
+
+    // Mono buffers are packed one bit per pixel, line after line
+    const uint8_t *buf = (const uint8_t *)color_p;
+    int run_start = -1;
+
+    for (int y = area->y1; y <= area->y2 + 1; y++) {
+        const uint8_t *line = buf + (y - area->y1) * LINE_BYTES;
+        bool changed = y <= area->y2 &&
+                       (!shadow_valid[y] || memcmp(shadow[y], line, LINE_BYTES) != 0);
+
+        if (changed) {
+            memcpy(shadow[y], line, LINE_BYTES);
+            shadow_valid[y] = true;
+            if (run_start < 0) {
+                run_start = y;
+            }
+            continue;
+        }
+
+        if (y <= area->y2) {
+            area_lines_skipped++;
+        }
+        if (run_start >= 0) {
+            // Separate writes cost 2 bytes each, any unchanged line in between costs 22
+            write_lines(run_start, y - run_start, buf + (run_start - area->y1) * LINE_BYTES);
+            run_start = -1;
+        }
+    }
+
+    panel_flush_count(area_lines, area_lines_skipped, area_bytes);
+    area_lines = 0;
+    area_lines_skipped = 0;
+    area_bytes = 0;
+
+    lv_disp_flush_ready(drv);
+}
+
+void line_flush_init(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+
+    if (disp == NULL || !device_is_ready(display)) {
+        return;
+    }
+    if (disp->driver->hor_res != PANEL_WIDTH || disp->driver->ver_res != PANEL_LINES) {
+        LOG_WRN("Display is %dx%d, not diffing lines", disp->driver->hor_res,
+                disp->driver->ver_res);
+        return;
+    }
+
+    panel_flush_cb = disp->driver->flush_cb;
+    disp->driver->flush_cb = line_flush_cb;
+}
@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+
+// Put the line diff in front of the default display's flush callback. Lines
+// that match the last transmitted frame are dropped, the rest are sent in one
+// write per run of consecutive lines.
+void line_flush_init(void);
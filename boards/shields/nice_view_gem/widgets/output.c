@@ -1,51 +1,42 @@
 #include <zephyr/kernel.h>
 #include "output.h"
+#include "raster.h"
 #include "../assets/custom_fonts.h"
 
-LV_IMG_DECLARE(bt_no_signal);
-LV_IMG_DECLARE(bt_unbonded);
-LV_IMG_DECLARE(bt);
-LV_IMG_DECLARE(usb);
+RASTER_IMG_DECLARE(bt_no_signal_canvas);
+RASTER_IMG_DECLARE(bt_unbonded_canvas);
+RASTER_IMG_DECLARE(bt_canvas);
+RASTER_IMG_DECLARE(usb_canvas);
 
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
 static void draw_usb_connected(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 45, 2, &usb, &img_dsc);
+    raster_blit(lv_canvas_get_img(canvas), 45, 2, &usb_canvas);
 }
 
 static void draw_ble_unbonded(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 44, 0, &bt_unbonded, &img_dsc);
+    raster_blit(lv_canvas_get_img(canvas), 44, 0, &bt_unbonded_canvas);
 }
 #endif
 
 static void draw_ble_disconnected(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 49, 0, &bt_no_signal, &img_dsc);
+    raster_blit(lv_canvas_get_img(canvas), 49, 0, &bt_no_signal_canvas);
 }
 
 static void draw_ble_connected(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 49, 0, &bt, &img_dsc);
+    raster_blit(lv_canvas_get_img(canvas), 49, 0, &bt_canvas);
 }
 
-void draw_output_status(lv_obj_t *canvas, const struct status_state *state) {
+void draw_output_static(lv_obj_t *canvas) {
     lv_draw_label_dsc_t label_dsc;
     init_label_dsc(&label_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 1, 25, &label_dsc, "SIG");
+    canvas_draw_text(canvas, 0, 1, 25, &label_dsc, "SIG");
 
     lv_draw_rect_dsc_t rect_white_dsc;
     init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    lv_canvas_draw_rect(canvas, 43, 0, 24, 15, &rect_white_dsc);
+    canvas_draw_rect(canvas, 43, 0, 24, 15, &rect_white_dsc);
+}
 
+void draw_output_status(lv_obj_t *canvas, const struct status_state *state) {
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
     switch (state->selected_endpoint.transport) {
     case ZMK_TRANSPORT_USB:
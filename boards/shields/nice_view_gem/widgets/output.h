@@ -19,4 +19,6 @@ struct peripheral_status_state {
 };
 #endif
 
+// Label and icon frame, drawn once into the static layer
+void draw_output_static(lv_obj_t *canvas);
 void draw_output_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
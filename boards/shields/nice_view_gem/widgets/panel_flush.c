@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+
+#include "panel_flush.h"
+#include "render_stats.h"
+#include "trace.h"
+
+// The flush installed before, LVGL's own or the line diff
+static void (*panel_flush_cb)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+
+// Whether the installed flush reported the current area itself
+static bool area_counted;
+
+// Totals of the frame being flushed, which ends with lv_disp_flush_is_last()
+static uint16_t frame_lines;
+static uint16_t frame_lines_skipped;
+static uint32_t frame_bytes;
+
+void panel_flush_count(uint16_t lines, uint16_t lines_skipped, uint32_t bytes) {
+    frame_lines += lines;
+    frame_lines_skipped += lines_skipped;
+    frame_bytes += bytes;
+    area_counted = true;
+}
+
+static void hooked_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    int lines = area->y2 - area->y1 + 1;
+
+    GEM_TRACE_BEGIN("flush", lines);
+
+    area_counted = false;
+    panel_flush_cb(drv, area, color_p);
+
+    // LVGL's flush writes the area as it is, rounded to whole lines on this panel
+    if (!area_counted) {
+        panel_flush_count(lines, 0, PANEL_WIRE_BYTES(lines, drv->hor_res / 8));
+    }
+
+    // Still set after the flush reported ready, until LVGL starts the next one
+    if (lv_disp_flush_is_last(drv)) {
+        render_stats_flush_frame(frame_lines, frame_lines_skipped, frame_bytes);
+        frame_lines = 0;
+        frame_lines_skipped = 0;
+        frame_bytes = 0;
+    }
+
+    GEM_TRACE_END("flush", lines);
+}
+
+void panel_flush_init(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+    if (disp == NULL || disp->driver->flush_cb == hooked_flush_cb) {
+        return;
+    }
+
+    panel_flush_cb = disp->driver->flush_cb;
+    disp->driver->flush_cb = hooked_flush_cb;
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+// SPI bytes of one sharp,ls0xx write of whole lines: a command byte, then
+// address, data and dummy byte per line, then a trailer byte
+#define PANEL_WIRE_BYTES(lines, line_bytes) (2 + (lines) * ((line_bytes) + 2))
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_TRACING) || IS_ENABLED(CONFIG_NICE_VIEW_GEM_RENDER_STATS)
+// Put a span around every call of the default display's flush callback,
+// whichever callback is installed, and count the lines and bytes each frame
+// sends. Called after line_flush_init() it also covers the line diff.
+void panel_flush_init(void);
+
+// Report what the installed flush sent for the area being flushed, instead of
+// the whole area. Lines skipped were left out because the panel holds them.
+void panel_flush_count(uint16_t lines, uint16_t lines_skipped, uint32_t bytes);
+#else
+static inline void panel_flush_init(void) {}
+static inline void panel_flush_count(uint16_t lines, uint16_t lines_skipped, uint32_t bytes) {}
+#endif
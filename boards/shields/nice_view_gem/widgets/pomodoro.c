@@ -4,8 +4,12 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zmk/display.h>
 #include <math.h>
+#include <string.h>
 #include "pomodoro.h"
+#include "raster.h"
+#include "render_stats.h"
 #include "screen.h"
 
 // Default durations in seconds (configurable via Kconfig)
@@ -21,6 +25,9 @@
 #define WORK_DURATION_SEC (CONFIG_NICE_VIEW_GEM_POMODORO_WORK_DURATION * 60)
 #define BREAK_DURATION_SEC (CONFIG_NICE_VIEW_GEM_POMODORO_BREAK_DURATION * 60)
 
+// Longest session the countdown cells can show, as "999:00"
+#define MAX_DURATION_SEC (999 * 60)
+
 // Battery saving: update every 5% progress
 #define BATTERY_SAVE_UPDATE_PERCENT 5
 
@@ -34,27 +41,82 @@ static struct pomodoro_data pom_data = {
     .break_duration = BREAK_DURATION_SEC
 };
 
+// Guards pom_data and last_tick_time: behaviors change them, the display thread ticks and draws
+static struct k_spinlock pom_lock;
+
 static int64_t last_tick_time = 0;
+// Bumped under pom_lock on every change that shows on the screen
+static uint32_t pom_generation;
 static uint8_t last_display_percent = 0;  // For battery saving mode (0-100)
+// Whether the pomodoro screen is shown; while hidden the timer only wakes for session changes
+static bool pomodoro_visible;
 
-// Periodic timer for display updates
+// Display update timer: periodic in live mode, otherwise a one-shot armed for the next 5% step.
+// While the screen is hidden, a one-shot armed for the end of the session.
 static void pomodoro_timer_handler(struct k_work *work);
 static void pomodoro_timer_expiry(struct k_timer *timer);
 
 K_WORK_DEFINE(pomodoro_work, pomodoro_timer_handler);
 K_TIMER_DEFINE(pomodoro_timer, pomodoro_timer_expiry, NULL);
 
+static bool pomodoro_tick_locked(void);
+
+#ifndef CONFIG_NICE_VIEW_GEM_POMODORO_MODE_LIVE
+// Milliseconds until the progress reaches the next 5% step or the session ends
+static int64_t next_step_delay_locked(void) {
+    uint32_t duration = pom_data.session_duration;
+    if (duration == 0) {
+        return 0;
+    }
+
+    uint32_t step = pom_data.elapsed_seconds * 100 / duration / BATTERY_SAVE_UPDATE_PERCENT;
+    // First whole second at which elapsed * 100 / duration lands on the next step
+    uint32_t next = DIV_ROUND_UP((step + 1) * BATTERY_SAVE_UPDATE_PERCENT * duration, 100);
+    next = MIN(next, duration);
+
+    // Ticks count whole seconds from last_tick_time, so this is exactly when the step shows up
+    int64_t deadline = last_tick_time + (int64_t)(next - pom_data.elapsed_seconds) * 1000;
+    return MAX(deadline - k_uptime_get(), 0);
+}
+#endif
+
+// Milliseconds until the session ends and switches between work and break
+static int64_t session_end_delay_locked(void) {
+    uint32_t left = pom_data.session_duration - MIN(pom_data.elapsed_seconds,
+                                                    pom_data.session_duration);
+    int64_t deadline = last_tick_time + (int64_t)left * 1000;
+    return MAX(deadline - k_uptime_get(), 0);
+}
+
+// Called with pom_lock held while a session runs
+static void arm_pomodoro_timer_locked(void) {
+    if (!pomodoro_visible) {
+        k_timer_start(&pomodoro_timer, K_MSEC(session_end_delay_locked()), K_NO_WAIT);
+        return;
+    }
+#ifdef CONFIG_NICE_VIEW_GEM_POMODORO_MODE_LIVE
+    k_timer_start(&pomodoro_timer, K_SECONDS(1), K_SECONDS(1));
+#else
+    k_timer_start(&pomodoro_timer, K_MSEC(next_step_delay_locked()), K_NO_WAIT);
+#endif
+}
+
+static bool pomodoro_running_locked(void) {
+    return pom_data.state == POM_RUNNING_WORK || pom_data.state == POM_RUNNING_BREAK;
+}
+
 static void pomodoro_timer_handler(struct k_work *work) {
-    enum pomodoro_state prev_state = pom_data.state;
-    pomodoro_tick();
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
+    bool state_changed = pomodoro_tick_locked();
+    RENDER_STATS_INC(pomodoro_wakeups);
+    RENDER_STATS_INC(timer_wakeups);
     
 #ifdef CONFIG_NICE_VIEW_GEM_POMODORO_MODE_LIVE
     // Live mode: update every second
-    zmk_widget_screen_refresh();
+    ARG_UNUSED(state_changed);
+    bool refresh = true;
 #else
     // Interval or Clock-only mode: only update every 5% or on state change
-    bool state_changed = (prev_state != pom_data.state);
-    
     // Calculate current progress percentage (0-100)
     uint8_t current_percent = 0;
     if (pom_data.session_duration > 0) {
@@ -65,42 +127,100 @@ static void pomodoro_timer_handler(struct k_work *work) {
     uint8_t current_step = current_percent / BATTERY_SAVE_UPDATE_PERCENT;
     uint8_t last_step = last_display_percent / BATTERY_SAVE_UPDATE_PERCENT;
     
-    if (state_changed || current_step != last_step) {
+    bool refresh = state_changed || current_step != last_step;
+    if (refresh) {
         last_display_percent = current_percent;
-        zmk_widget_screen_refresh();
     }
 #endif
+
+    // Sleep until the next visible change, unless paused or reset in the meantime. The live
+    // mode timer is periodic while the screen is shown.
+    bool periodic = IS_ENABLED(CONFIG_NICE_VIEW_GEM_POMODORO_MODE_LIVE) && pomodoro_visible;
+    if (pomodoro_running_locked() && !periodic) {
+        arm_pomodoro_timer_locked();
+    }
+    k_spin_unlock(&pom_lock, key);
+
+    if (refresh) {
+        zmk_widget_screen_refresh(&gem_screen_pomodoro);
+    }
 }
 
 static void pomodoro_timer_expiry(struct k_timer *timer) {
-    k_work_submit(&pomodoro_work);
+    // Tick on the display thread, next to the drawing code that reads the state
+    k_work_submit_to_queue(zmk_display_work_q(), &pomodoro_work);
 }
 
+// Called with pom_lock held, after last_tick_time was set
 static void start_pomodoro_timer(void) {
     last_display_percent = 0;  // Reset for fresh display updates
-    k_timer_start(&pomodoro_timer, K_SECONDS(1), K_SECONDS(1));
+    arm_pomodoro_timer_locked();
 }
 
 static void stop_pomodoro_timer(void) {
     k_timer_stop(&pomodoro_timer);
 }
 
+// Digits 0-9 followed by ':', from assets/pomodoro_digits.c
+extern const struct raster_img pomodoro_digits[];
+
 // Circle drawing constants
 #define OUTER_RADIUS 28
 #define MAX_INNER_RADIUS 24
 #define CIRCLE_CENTER_X 34
 #define CIRCLE_CENTER_Y 38
 
+// Pie angle map: quantized clockwise angle from 12 o'clock of every pixel in the
+// pie disc, indexed [x][y] so runs along y are contiguous rows in the canvas buffer
+#define PIE_RADIUS (OUTER_RADIUS - 7)
+#define PIE_SIZE (2 * PIE_RADIUS + 1)
+#define PIE_ANGLE_STEPS 254
+#define PIE_OUTSIDE 0xFF
+
+static uint8_t pie_angle[PIE_SIZE][PIE_SIZE];
+
+// Clockwise angle from 12 o'clock of a pixel relative to the pie center
+static float pie_pixel_angle(int px, int py) {
+    // atan2 gives angle from positive x-axis, we want from negative y-axis (top)
+    float angle = atan2((float)px, (float)(-py));
+    if (angle < 0) angle += 2.0f * 3.14159265f;
+    return angle;
+}
+
+// Angle map step of an angle. It never decreases as the angle grows, so a pixel in a
+// lower step than the segment end is always inside and one in a higher step never is.
+static uint8_t pie_step(float angle) {
+    return (uint8_t)(angle * PIE_ANGLE_STEPS / (2.0f * 3.14159265f));
+}
+
+static void build_pie_angle_map(void) {
+    for (int px = -PIE_RADIUS; px <= PIE_RADIUS; px++) {
+        for (int py = -PIE_RADIUS; py <= PIE_RADIUS; py++) {
+            uint8_t *cell = &pie_angle[px + PIE_RADIUS][py + PIE_RADIUS];
+            if (px * px + py * py > PIE_RADIUS * PIE_RADIUS) {
+                *cell = PIE_OUTSIDE;
+                continue;
+            }
+            *cell = pie_step(pie_pixel_angle(px, py));
+        }
+    }
+}
+
 void pomodoro_init(void) {
+    build_pie_angle_map();
+
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
     pom_data.state = POM_IDLE;
     pom_data.elapsed_seconds = 0;
     pom_data.work_duration = WORK_DURATION_SEC;
     pom_data.break_duration = BREAK_DURATION_SEC;
     pom_data.session_duration = pom_data.work_duration;
     last_tick_time = k_uptime_get();
+    k_spin_unlock(&pom_lock, key);
 }
 
 void pomodoro_start_stop(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
     switch (pom_data.state) {
     case POM_IDLE:
         // Move to break setup (work time is configured)
@@ -128,34 +248,43 @@ void pomodoro_start_stop(void) {
         start_pomodoro_timer();
         break;
     }
+    pom_generation++;
+    k_spin_unlock(&pom_lock, key);
 }
 
 void pomodoro_reset(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
     stop_pomodoro_timer();
     pom_data.state = POM_IDLE;
     pom_data.elapsed_seconds = 0;
     pom_data.work_duration = WORK_DURATION_SEC;
     pom_data.break_duration = BREAK_DURATION_SEC;
     pom_data.session_duration = pom_data.work_duration;
+    pom_generation++;
+    k_spin_unlock(&pom_lock, key);
 }
 
 // Context-aware time adjustment:
 // - IDLE: adjust work duration
 // - SETUP_BREAK or during break: adjust break duration
 void pomodoro_add_time(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
     if (pom_data.state == POM_SETUP_BREAK ||
         pom_data.state == POM_RUNNING_BREAK || 
         (pom_data.state == POM_PAUSED && pom_data.paused_from == POM_RUNNING_BREAK)) {
-        // Setup break or during break: adjust break duration
-        pom_data.break_duration += 60;  // Add 1 minute
+        // Setup break or during break: add 1 minute to the break duration
+        pom_data.break_duration = MIN(pom_data.break_duration + 60, MAX_DURATION_SEC);
     } else if (pom_data.state == POM_IDLE) {
-        // IDLE: adjust work duration
-        pom_data.work_duration += 300;  // Add 5 minutes
+        // IDLE: add 5 minutes to the work duration
+        pom_data.work_duration = MIN(pom_data.work_duration + 300, MAX_DURATION_SEC);
         pom_data.session_duration = pom_data.work_duration;
     }
+    pom_generation++;
+    k_spin_unlock(&pom_lock, key);
 }
 
 void pomodoro_sub_time(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
     if (pom_data.state == POM_SETUP_BREAK ||
         pom_data.state == POM_RUNNING_BREAK || 
         (pom_data.state == POM_PAUSED && pom_data.paused_from == POM_RUNNING_BREAK)) {
@@ -168,37 +297,62 @@ void pomodoro_sub_time(void) {
         pom_data.work_duration -= 300;  // Sub 5 minutes (min 5 min)
         pom_data.session_duration = pom_data.work_duration;
     }
+    pom_generation++;
+    k_spin_unlock(&pom_lock, key);
 }
 
-enum pomodoro_state pomodoro_get_state(void) {
-    return pom_data.state;
+// Consistent copy of the timer state for readers outside the lock
+static struct pomodoro_data pomodoro_get_data(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
+    struct pomodoro_data data = pom_data;
+    k_spin_unlock(&pom_lock, key);
+    return data;
 }
 
-uint32_t pomodoro_get_remaining_seconds(void) {
-    if (pom_data.elapsed_seconds >= pom_data.session_duration) {
+static uint32_t remaining_seconds(const struct pomodoro_data *data) {
+    if (data->elapsed_seconds >= data->session_duration) {
         return 0;
     }
-    return pom_data.session_duration - pom_data.elapsed_seconds;
+    return data->session_duration - data->elapsed_seconds;
+}
+
+enum pomodoro_state pomodoro_get_state(void) {
+    return pomodoro_get_data().state;
+}
+
+uint32_t pomodoro_get_remaining_seconds(void) {
+    struct pomodoro_data data = pomodoro_get_data();
+    return remaining_seconds(&data);
 }
 
 uint32_t pomodoro_get_session_duration(void) {
-    return pom_data.session_duration;
+    return pomodoro_get_data().session_duration;
 }
 
 uint8_t pomodoro_get_progress_step(void) {
+    struct pomodoro_data data = pomodoro_get_data();
+
     // Calculate which 5-minute step we're in (0-5 for 25 min session)
-    uint32_t elapsed_minutes = pom_data.elapsed_seconds / 60;
+    uint32_t elapsed_minutes = data.elapsed_seconds / 60;
     uint8_t step = elapsed_minutes / 5;
-    uint8_t max_steps = pom_data.session_duration / 300;
+    uint8_t max_steps = data.session_duration / 300;
     if (step > max_steps) step = max_steps;
     return step;
 }
 
 void pomodoro_tick(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
+    pomodoro_tick_locked();
+    k_spin_unlock(&pom_lock, key);
+}
+
+// Advances the running session, returns true if it switched between work and break
+static bool pomodoro_tick_locked(void) {
     if (pom_data.state != POM_RUNNING_WORK && 
         pom_data.state != POM_RUNNING_BREAK) {
-        return;
+        return false;
     }
+    bool state_changed = false;
 
     int64_t now = k_uptime_get();
     int64_t delta_ms = now - last_tick_time;
@@ -206,6 +360,7 @@ void pomodoro_tick(void) {
     if (delta_ms >= 1000) {
         pom_data.elapsed_seconds += delta_ms / 1000;
         last_tick_time = now - (delta_ms % 1000);
+        pom_generation++;
         
         // Check if session complete
         if (pom_data.elapsed_seconds >= pom_data.session_duration) {
@@ -220,128 +375,148 @@ void pomodoro_tick(void) {
                 pom_data.state = POM_RUNNING_WORK;
                 pom_data.session_duration = pom_data.work_duration;
             }
+            state_changed = true;
         }
     }
+    return state_changed;
 }
 
-// Draw circle outline
-static void draw_circle_outline(lv_obj_t *canvas, int cx, int cy, int radius, 
-                                 lv_draw_rect_dsc_t *dsc) {
-    // Midpoint circle algorithm
-    int x = radius;
-    int y = 0;
-    int err = 0;
-
-    while (x >= y) {
-        // Draw 8 octants
-        lv_canvas_draw_rect(canvas, cx + x, cy + y, 1, 1, dsc);
-        lv_canvas_draw_rect(canvas, cx + y, cy + x, 1, 1, dsc);
-        lv_canvas_draw_rect(canvas, cx - y, cy + x, 1, 1, dsc);
-        lv_canvas_draw_rect(canvas, cx - x, cy + y, 1, 1, dsc);
-        lv_canvas_draw_rect(canvas, cx - x, cy - y, 1, 1, dsc);
-        lv_canvas_draw_rect(canvas, cx - y, cy - x, 1, 1, dsc);
-        lv_canvas_draw_rect(canvas, cx + y, cy - x, 1, 1, dsc);
-        lv_canvas_draw_rect(canvas, cx + x, cy - y, 1, 1, dsc);
-
-        y++;
-        err += 1 + 2 * y;
-        if (2 * (err - x) + 1 > 0) {
-            x--;
-            err += 1 - 2 * x;
-        }
+// Whether the pixel at column x, row y of the angle map is within a segment ending at
+// end_angle. Only pixels in the same step as the end need their exact angle.
+static bool pie_covers(int x, int y, uint8_t end_step, float end_angle) {
+    uint8_t step = pie_angle[x][y];
+    if (step != end_step) {
+        return step < end_step;  // PIE_OUTSIDE is above every step
     }
+    return pie_pixel_angle(x - PIE_RADIUS, y - PIE_RADIUS) <= end_angle;
 }
 
-// Draw a filled pie segment clockwise from 12 o'clock
-// progress: 0.0 to 1.0 (0% to 100%)
-static void draw_pie_segment(lv_obj_t *canvas, int cx, int cy, int radius,
-                              float progress, lv_draw_rect_dsc_t *dsc) {
-    if (progress <= 0.0f) return;
-    if (progress > 1.0f) progress = 1.0f;
-    
-    // Calculate end angle in radians (clockwise from top)
-    // Top is -PI/2, full circle is -PI/2 + 2*PI
-    float end_angle = progress * 2.0f * 3.14159265f;
-    
-    // Draw filled pie by checking each pixel
-    for (int py = -radius; py <= radius; py++) {
-        for (int px = -radius; px <= radius; px++) {
-            // Check if point is within circle
-            if (px * px + py * py > radius * radius) continue;
-            
-            // Calculate angle of this point from center (clockwise from top)
-            // atan2 gives angle from positive x-axis, we want from negative y-axis (top)
-            float angle = atan2((float)px, (float)(-py));
-            if (angle < 0) angle += 2.0f * 3.14159265f;
-            
-            // Check if angle is within the pie segment
-            if (angle <= end_angle) {
-                int draw_x = cx + px;
-                int draw_y = cy + py;
-                if (draw_x >= 0 && draw_x < BUFFER_SIZE && 
-                    draw_y >= 0 && draw_y < BUFFER_SIZE) {
-                    lv_canvas_draw_rect(canvas, draw_x, draw_y, 1, 1, dsc);
-                }
+// Draw a filled pie segment clockwise from 12 o'clock, up to end_angle in radians.
+// Returns the number of pixels in the segment.
+static int draw_pie_segment(const lv_img_dsc_t *img, int cx, int cy, float end_angle,
+                            lv_color_t color) {
+    uint8_t end_step = pie_step(end_angle);
+    int pixels = 0;
+
+    // Fill each column as spans of pixels whose angle is within the segment
+    for (int x = 0; x < PIE_SIZE; x++) {
+        int y = 0;
+        while (y < PIE_SIZE) {
+            if (!pie_covers(x, y, end_step, end_angle)) {
+                y++;
+                continue;
             }
+            int start = y;
+            while (y < PIE_SIZE && pie_covers(x, y, end_step, end_angle)) {
+                y++;
+            }
+            raster_vline(img, cx - PIE_RADIUS + x, cy - PIE_RADIUS + start, y - start, color);
+            pixels += y - start;
         }
     }
+    return pixels;
 }
 
-void draw_pomodoro(lv_obj_t *canvas) {
-    lv_draw_rect_dsc_t fg_dsc;
-    init_rect_dsc(&fg_dsc, LVGL_FOREGROUND);
-    
-    lv_draw_rect_dsc_t bg_dsc;
-    init_rect_dsc(&bg_dsc, LVGL_BACKGROUND);
-    
-    // Use larger font (18pt) for time display
-    lv_draw_label_dsc_t time_label_dsc;
-    init_label_dsc(&time_label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_18, LV_TEXT_ALIGN_CENTER);
-
-    char time_str[16];
-    
-    if (pom_data.state == POM_IDLE) {
+// Countdown cells: fixed-width digits so each one can be redrawn on its own
+#define TIME_Y 2
+#define TIME_MAX_LEN 6  // "999:00", see MAX_DURATION_SEC
+#define DIGIT_CELL_W 11
+#define COLON_CELL_W 4
+#define COLON_GLYPH 10
+
+// What the countdown and pie currently show on the canvas
+static struct {
+    enum pomodoro_state state;
+    char time[TIME_MAX_LEN + 1];
+    // End angle of the pie, negative while nothing has elapsed, and its pixel count
+    float pie;
+    int pie_pixels;
+} drawn;
+
+static void format_time(const struct pomodoro_data *data, char *buf, size_t size) {
+    if (data->state == POM_IDLE) {
         // In IDLE, always show work time being configured
-        uint32_t work_min = pom_data.work_duration / 60;
-        snprintf(time_str, sizeof(time_str), "%02u:00", work_min);
-        lv_canvas_draw_text(canvas, 4, 0, 60, &time_label_dsc, time_str);
-    } else if (pom_data.state == POM_SETUP_BREAK) {
+        snprintf(buf, size, "%02u:00", data->work_duration / 60);
+    } else if (data->state == POM_SETUP_BREAK) {
         // In SETUP_BREAK, always show break time being configured
-        uint32_t break_min = pom_data.break_duration / 60;
-        snprintf(time_str, sizeof(time_str), "%02u:00", break_min);
-        lv_canvas_draw_text(canvas, 4, 0, 60, &time_label_dsc, time_str);
+        snprintf(buf, size, "%02u:00", data->break_duration / 60);
     } else {
 #ifndef CONFIG_NICE_VIEW_GEM_POMODORO_MODE_CLOCK_ONLY
         // Show remaining time (MM:SS) in Live and Interval modes
-        uint32_t remaining = pomodoro_get_remaining_seconds();
-        uint32_t minutes = remaining / 60;
-        uint32_t seconds = remaining % 60;
-        snprintf(time_str, sizeof(time_str), "%u:%02u", minutes, seconds);
-        lv_canvas_draw_text(canvas, 4, 0, 60, &time_label_dsc, time_str);
-#endif
+        uint32_t remaining = remaining_seconds(data);
+        snprintf(buf, size, "%u:%02u", remaining / 60, remaining % 60);
+#else
         // Clock-only mode: no time display while running
+        buf[0] = '\0';
+#endif
+    }
+}
+
+// End angle of the pie in radians clockwise from 12 o'clock, or -1 while nothing has
+// elapsed
+static float pie_end_angle(const struct pomodoro_data *data) {
+    if (data->session_duration == 0 || data->elapsed_seconds == 0) {
+        return -1.0f;
+    }
+    float progress = (float)data->elapsed_seconds / (float)data->session_duration;
+    if (progress > 1.0f) progress = 1.0f;
+    return progress * 2.0f * 3.14159265f;
+}
+
+static lv_coord_t time_start_x(size_t len) {
+    // One colon cell, the rest are digits
+    lv_coord_t width = (len - 1) * DIGIT_CELL_W + COLON_CELL_W;
+    return (BUFFER_SIZE - width) / 2;
+}
+
+// Draw the cells of time that differ from prev, all of them if prev is NULL
+static void draw_time_cells(lv_obj_t *canvas, const char *time, const char *prev) {
+    if (*time == '\0') {
+        return;
     }
 
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    lv_coord_t x = time_start_x(strlen(time));
+
+    for (const char *c = time; *c != '\0'; c++) {
+        lv_coord_t cell_w = *c == ':' ? COLON_CELL_W : DIGIT_CELL_W;
+        if (prev == NULL || *c != prev[c - time]) {
+            const struct raster_img *glyph = &pomodoro_digits[*c == ':' ? COLON_GLYPH : *c - '0'];
+            raster_rect(img, x, TIME_Y, cell_w, glyph->h, LVGL_BACKGROUND);
+            raster_blit_mask(img, x + 1, TIME_Y, glyph, LVGL_FOREGROUND);
+            if (prev != NULL) {
+                canvas_invalidate_rect(canvas, x, TIME_Y, cell_w, glyph->h);
+            }
+            RENDER_STATS_INC(pomodoro_cells_drawn);
+        }
+        x += cell_w;
+    }
+}
+
+void draw_pomodoro(lv_obj_t *canvas) {
+    struct pomodoro_data data = pomodoro_get_data();
+
+    drawn.state = data.state;
+    format_time(&data, drawn.time, sizeof(drawn.time));
+    draw_time_cells(canvas, drawn.time, NULL);
+
     // Draw outer circle outline (moved down to make room for bigger text)
     int circle_y = CIRCLE_CENTER_Y + 4;
-    draw_circle_outline(canvas, CIRCLE_CENTER_X, circle_y, OUTER_RADIUS - 4, &fg_dsc);
-    draw_circle_outline(canvas, CIRCLE_CENTER_X, circle_y, OUTER_RADIUS - 5, &fg_dsc);
-    
-    // Calculate progress as fraction of elapsed time
-    float progress = 0.0f;
-    if (pom_data.session_duration > 0) {
-        progress = (float)pom_data.elapsed_seconds / (float)pom_data.session_duration;
-    }
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    raster_circle(img, CIRCLE_CENTER_X, circle_y, OUTER_RADIUS - 4, LVGL_FOREGROUND);
+    raster_circle(img, CIRCLE_CENTER_X, circle_y, OUTER_RADIUS - 5, LVGL_FOREGROUND);
     
     // Draw pie segment filling clockwise from top
-    if (progress > 0.0f) {
-        draw_pie_segment(canvas, CIRCLE_CENTER_X, circle_y, 
-                         OUTER_RADIUS - 7, progress, &fg_dsc);
+    drawn.pie = pie_end_angle(&data);
+    drawn.pie_pixels = 0;
+    if (drawn.pie > 0.0f) {
+        drawn.pie_pixels =
+            draw_pie_segment(img, CIRCLE_CENTER_X, circle_y, drawn.pie, LVGL_FOREGROUND);
     }
     
     // Draw state label below circle
     const char *state_str;
-    switch (pom_data.state) {
+    switch (data.state) {
     case POM_IDLE:
         state_str = "IDLE";
         break;
@@ -363,5 +538,79 @@ void draw_pomodoro(lv_obj_t *canvas) {
     
     lv_draw_label_dsc_t state_label_dsc;
     init_label_dsc(&state_label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_18, LV_TEXT_ALIGN_CENTER);
-    lv_canvas_draw_text(canvas, 0, 48, 68, &state_label_dsc, state_str);
+    canvas_draw_text(canvas, 0, 48, 68, &state_label_dsc, state_str);
+}
+
+static void draw_pomodoro_screen(lv_obj_t *canvas, const struct status_state *state) {
+    pomodoro_tick();  // Update timer
+    draw_pomodoro(canvas);
+}
+
+// The draw on entering catches up with the time that passed while hidden
+static void pomodoro_screen_enter(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
+    pomodoro_visible = true;
+    if (pomodoro_running_locked()) {
+        pomodoro_tick_locked();
+        last_display_percent = pom_data.session_duration > 0
+                                   ? pom_data.elapsed_seconds * 100 / pom_data.session_duration
+                                   : 0;
+        arm_pomodoro_timer_locked();
+    }
+    k_spin_unlock(&pom_lock, key);
+}
+
+static void pomodoro_screen_leave(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
+    pomodoro_visible = false;
+    if (pomodoro_running_locked()) {
+        arm_pomodoro_timer_locked();
+    }
+    k_spin_unlock(&pom_lock, key);
+}
+
+static uint32_t pomodoro_generation(void) {
+    k_spinlock_key_t key = k_spin_lock(&pom_lock);
+    uint32_t generation = pom_generation;
+    k_spin_unlock(&pom_lock, key);
+    return generation;
+}
+
+GEM_SCREEN_DEFINE(pomodoro, 20, .draw = draw_pomodoro_screen, .tick = update_pomodoro,
+                  .generation = pomodoro_generation, .enter = pomodoro_screen_enter,
+                  .leave = pomodoro_screen_leave);
+
+void update_pomodoro(lv_obj_t *canvas) {
+    pomodoro_tick();
+    struct pomodoro_data data = pomodoro_get_data();
+
+    char time[TIME_MAX_LEN + 1];
+    format_time(&data, time, sizeof(time));
+    float pie = pie_end_angle(&data);
+
+    // A new state or a shrinking pie changes most of the screen
+    if (data.state != drawn.state || strlen(time) != strlen(drawn.time) || pie < drawn.pie) {
+        fill_background(canvas);
+        draw_pomodoro(canvas);
+        lv_obj_invalidate(canvas);
+        return;
+    }
+
+    RENDER_STATS_INC(pomodoro_updates_in_place);
+    draw_time_cells(canvas, time, drawn.time);
+    strcpy(drawn.time, time);
+
+    // The pie only grows within a session, so the new segment is drawn over the old one.
+    // It is only sent to the panel once it covers more pixels.
+    if (pie > drawn.pie) {
+        int circle_y = CIRCLE_CENTER_Y + 4;
+        int pixels = draw_pie_segment(lv_canvas_get_img(canvas), CIRCLE_CENTER_X, circle_y, pie,
+                                      LVGL_FOREGROUND);
+        if (pixels != drawn.pie_pixels) {
+            canvas_invalidate_rect(canvas, CIRCLE_CENTER_X - PIE_RADIUS, circle_y - PIE_RADIUS,
+                                   PIE_SIZE, PIE_SIZE);
+            drawn.pie_pixels = pixels;
+        }
+        drawn.pie = pie;
+    }
 }
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <lvgl.h>
+#include "screen_registry.h"
 #include "util.h"
 
 // Pomodoro states
@@ -39,8 +40,12 @@ uint32_t pomodoro_get_remaining_seconds(void);
 uint32_t pomodoro_get_session_duration(void);
 uint8_t pomodoro_get_progress_step(void);  // 0-5 for 5-min increments
 
-// Drawing function
+// Drawing functions
 void draw_pomodoro(lv_obj_t *canvas);
+// Tick and redraw only the countdown cells and pie steps that changed since the last draw
+void update_pomodoro(lv_obj_t *canvas);
+
+GEM_SCREEN_DECLARE(pomodoro);
 
 // Timer management (called by screen refresh)
 void pomodoro_tick(void);
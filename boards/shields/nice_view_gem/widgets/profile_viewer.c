@@ -1,5 +1,6 @@
 #include <zephyr/kernel.h>
 #include "profile_viewer.h"
+#include "screen_registry.h"
 
 static void draw_profile_circles(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_arc_dsc_t arc_dsc;
@@ -21,26 +22,26 @@ static void draw_profile_circles(lv_obj_t *canvas, const struct status_state *st
         bool selected = i == state->active_profile_index;
 
         if (state->profiles_connected[i]) {
-            lv_canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13, 0, 360,
+            canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13, 0, 360,
                             &arc_dsc);
         } else if (state->profiles_bonded[i]) {
             const int segments = 8;
             const int gap = 20;
             for (int j = 0; j < segments; ++j)
-                lv_canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13,
+                canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13,
                                 360. / segments * j + gap / 2.0,
                                 360. / segments * (j + 1) - gap / 2.0, &arc_dsc);
         }
 
         if (selected) {
-            lv_canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 9, 0, 359,
+            canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 9, 0, 359,
                             &arc_dsc_filled);
         }
 
         char label[2];
         snprintf(label, sizeof(label), "%d", i + 1);
         // Center the text in the circle - adjust x and y for proper centering
-        lv_canvas_draw_text(canvas, circle_offsets[i][0] - 9, circle_offsets[i][1] - 9, 18,
+        canvas_draw_text(canvas, circle_offsets[i][0] - 9, circle_offsets[i][1] - 9, 18,
                          (selected ? &label_dsc_black : &label_dsc), label);
     }
 }
@@ -49,3 +50,5 @@ void draw_profile_viewer_status(lv_obj_t *canvas, const struct status_state *sta
     draw_profile_circles(canvas, state);
 }
 
+GEM_SCREEN_DEFINE(profiles, 10, .draw = draw_profile_viewer_status,
+                  .inputs = GEM_SCREEN_INPUT_PROFILES);
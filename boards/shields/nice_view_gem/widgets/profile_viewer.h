@@ -1,7 +1,10 @@
 #pragma once
 
 #include <lvgl.h>
+#include "screen_registry.h"
 #include "util.h"
 
 void draw_profile_viewer_status(lv_obj_t *canvas, const struct status_state *state);
 
+GEM_SCREEN_DECLARE(profiles);
+
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raster.h"
+
+void raster_span(uint8_t *row, lv_coord_t from, lv_coord_t to, lv_color_t color) {
+    while (from < to) {
+        uint8_t mask = 0xff >> (from & 7);
+        lv_coord_t next = (from & ~7) + 8;
+        if (next > to) {
+            mask &= 0xff << (next - to);
+            next = to;
+        }
+        if (color.full) {
+            row[from >> 3] |= mask;
+        } else {
+            row[from >> 3] &= ~mask;
+        }
+        from = next;
+    }
+}
+
+void raster_clear(const lv_img_dsc_t *img, lv_color_t color) {
+    memset(canvas_row(img, 0), color.full ? 0xff : 0x00,
+           CANVAS_STRIDE(img->header.w) * img->header.h);
+}
+
+void raster_px(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_color_t color) {
+    lv_coord_t px = img->header.w - 1 - y;
+
+    if (x < 0 || x >= img->header.h || px < 0 || px >= img->header.w) {
+        return;
+    }
+
+    uint8_t *row = canvas_row(img, x);
+    if (color.full) {
+        row[px >> 3] |= 0x80 >> (px & 7);
+    } else {
+        row[px >> 3] &= ~(0x80 >> (px & 7));
+    }
+}
+
+void raster_hline(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                  lv_color_t color) {
+    raster_rect(img, x, y, len, 1, color);
+}
+
+void raster_vline(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                  lv_color_t color) {
+    if (x < 0 || x >= img->header.h) {
+        return;
+    }
+
+    lv_coord_t px1 = MAX(img->header.w - y - len, 0);
+    lv_coord_t px2 = MIN(img->header.w - y, (lv_coord_t)img->header.w);
+    raster_span(canvas_row(img, x), px1, px2, color);
+}
+
+void raster_rect(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                 lv_color_t color) {
+    lv_coord_t x1 = MAX(x, 0);
+    lv_coord_t x2 = MIN(x + w, (lv_coord_t)img->header.h);
+    lv_coord_t px1 = MAX(img->header.w - y - h, 0);
+    lv_coord_t px2 = MIN(img->header.w - y, (lv_coord_t)img->header.w);
+
+    // A portrait rect is still a rect on the landscape canvas
+    for (lv_coord_t row = x1; row < x2; row++) {
+        raster_span(canvas_row(img, row), px1, px2, color);
+    }
+}
+
+void raster_line(const lv_img_dsc_t *img, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2,
+                 lv_coord_t y2, lv_coord_t width, lv_color_t color) {
+    lv_coord_t dx = abs(x2 - x1);
+    lv_coord_t dy = -abs(y2 - y1);
+    lv_coord_t sx = x1 < x2 ? 1 : -1;
+    lv_coord_t sy = y1 < y2 ? 1 : -1;
+    lv_coord_t pen = (width - 1) / 2;
+    int32_t err = dx + dy;
+
+    while (true) {
+        if (width > 1) {
+            raster_rect(img, x1 - pen, y1 - pen, width, width, color);
+        } else {
+            raster_px(img, x1, y1, color);
+        }
+        if (x1 == x2 && y1 == y2) {
+            break;
+        }
+
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+void raster_circle(const lv_img_dsc_t *img, lv_coord_t cx, lv_coord_t cy, lv_coord_t r,
+                   lv_color_t color) {
+    lv_coord_t x = r;
+    lv_coord_t y = 0;
+    int32_t err = 0;
+
+    while (x >= y) {
+        raster_px(img, cx + x, cy + y, color);
+        raster_px(img, cx + y, cy + x, color);
+        raster_px(img, cx - y, cy + x, color);
+        raster_px(img, cx - x, cy + y, color);
+        raster_px(img, cx - x, cy - y, color);
+        raster_px(img, cx - y, cy - x, color);
+        raster_px(img, cx + y, cy - x, color);
+        raster_px(img, cx + x, cy - y, color);
+
+        y++;
+        err += 1 + 2 * y;
+        if (2 * (err - x) + 1 > 0) {
+            x--;
+            err += 1 - 2 * x;
+        }
+    }
+}
+
+// Largest dy with 4 * (dx^2 + dy^2) < limit, or -1 if there is none
+static lv_coord_t ring_extent(int32_t dx, int32_t limit, lv_coord_t r) {
+    lv_coord_t dy = r;
+    while (dy >= 0 && 4 * (dx * dx + dy * dy) >= limit) {
+        dy--;
+    }
+    return dy;
+}
+
+void raster_ring(const lv_img_dsc_t *img, lv_coord_t cx, lv_coord_t cy, lv_coord_t r,
+                 lv_coord_t width, lv_color_t color) {
+    int32_t outer = (2 * r + 1) * (2 * r + 1);
+    lv_coord_t inner_r = r - width;
+    int32_t inner = inner_r > 0 ? (2 * inner_r + 1) * (2 * inner_r + 1) : 0;
+
+    // Each column is at most two vertical runs, above and below the hole
+    for (lv_coord_t dx = -r; dx <= r; dx++) {
+        lv_coord_t out = ring_extent(dx, outer, r);
+        if (out < 0) {
+            continue;
+        }
+
+        lv_coord_t in = inner > 0 ? ring_extent(dx, inner, inner_r) : -1;
+        if (in < 0) {
+            raster_vline(img, cx + dx, cy - out, 2 * out + 1, color);
+        } else {
+            raster_vline(img, cx + dx, cy - out, out - in, color);
+            raster_vline(img, cx + dx, cy + in + 1, out - in, color);
+        }
+    }
+}
+
+// How source bits are combined with the canvas
+enum blit_op {
+    BLIT_COPY,
+    BLIT_SET,
+    BLIT_CLEAR,
+};
+
+static inline uint8_t blit_byte(uint8_t dst, uint8_t bits, uint8_t mask, enum blit_op op) {
+    switch (op) {
+    case BLIT_SET:
+        return dst | bits;
+    case BLIT_CLEAR:
+        return dst & ~bits;
+    default:
+        return (dst & ~mask) | bits;
+    }
+}
+
+// Combine n bits from src starting at bit sbit into dst starting at bit dbit
+static void blit_bits(uint8_t *dst, lv_coord_t dbit, const uint8_t *src, lv_coord_t sbit,
+                      lv_coord_t n, enum blit_op op) {
+    while (n > 0) {
+        // Next up to 8 source bits, left aligned
+        const uint8_t *s = &src[sbit >> 3];
+        uint8_t shift = sbit & 7;
+        uint8_t bits = s[0] << shift;
+        if (shift != 0 && n > 8 - shift) {
+            bits |= s[1] >> (8 - shift);
+        }
+
+        lv_coord_t count = MIN(n, 8);
+        uint8_t mask = 0xff << (8 - count);
+        bits &= mask;
+
+        // They straddle at most two destination bytes
+        uint8_t *d = &dst[dbit >> 3];
+        uint8_t offset = dbit & 7;
+        d[0] = blit_byte(d[0], bits >> offset, mask >> offset, op);
+        if (offset + count > 8) {
+            d[1] = blit_byte(d[1], bits << (8 - offset), mask << (8 - offset), op);
+        }
+
+        dbit += count;
+        sbit += count;
+        n -= count;
+    }
+}
+
+static void blit(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, const struct raster_img *src,
+                 enum blit_op op) {
+    uint32_t stride = (src->h + 7) >> 3;
+
+    // Source rows start at the image's bottom pixel, the leftmost canvas bit
+    lv_coord_t px1 = img->header.w - y - src->h;
+    lv_coord_t skip = MAX(-px1, 0);
+    lv_coord_t count = MIN(img->header.w - y, (lv_coord_t)img->header.w) - (px1 + skip);
+    if (count <= 0) {
+        return;
+    }
+
+    for (lv_coord_t col = MAX(-x, 0); col < src->w && x + col < img->header.h; col++) {
+        blit_bits(canvas_row(img, x + col), px1 + skip, &src->data[col * stride], skip, count,
+                  op);
+    }
+}
+
+void raster_blit(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y,
+                 const struct raster_img *src) {
+    blit(img, x, y, src, BLIT_COPY);
+}
+
+void raster_blit_mask(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y,
+                      const struct raster_img *mask, lv_color_t color) {
+    blit(img, x, y, mask, color.full ? BLIT_SET : BLIT_CLEAR);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include "util.h"
+
+/**
+ * Raster primitives writing straight into a packed 1-bit canvas image.
+ *
+ * Coordinates are the portrait ones used by the widgets (x along the 68 px
+ * panel height, y across the section), see util.c. Vertical lines map to a
+ * single canvas row and are the cheapest shape to draw. Everything is clipped
+ * to the canvas.
+ **/
+
+// 1-bit image stored in canvas order: one packed row of h bits per image column,
+// starting with the image's bottom pixel, holding canvas colors (1 is white)
+struct raster_img {
+    uint8_t w;
+    uint8_t h;
+    const uint8_t *data;
+};
+
+#define RASTER_IMG_DECLARE(name) extern const struct raster_img name
+
+// Set or clear bits [from, to) of a packed canvas row
+void raster_span(uint8_t *row, lv_coord_t from, lv_coord_t to, lv_color_t color);
+
+void raster_clear(const lv_img_dsc_t *img, lv_color_t color);
+void raster_px(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_color_t color);
+void raster_hline(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                  lv_color_t color);
+void raster_vline(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                  lv_color_t color);
+void raster_rect(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                 lv_color_t color);
+
+// Bresenham line between both end points, drawn with a width by width square pen
+void raster_line(const lv_img_dsc_t *img, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2,
+                 lv_coord_t y2, lv_coord_t width, lv_color_t color);
+
+// One pixel wide Bresenham circle outline
+void raster_circle(const lv_img_dsc_t *img, lv_coord_t cx, lv_coord_t cy, lv_coord_t r,
+                   lv_color_t color);
+
+// Filled ring of pixels whose centers lie within radius r but not within r - width,
+// measured against pixel edges like LVGL's circle masks. width >= r gives a disc.
+void raster_ring(const lv_img_dsc_t *img, lv_coord_t cx, lv_coord_t cy, lv_coord_t r,
+                 lv_coord_t width, lv_color_t color);
+
+// Copy an image with its top left corner at (x, y), overwriting both colors
+void raster_blit(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y,
+                 const struct raster_img *src);
+
+// Paint the set bits of a 1-bit mask in color, leaving the other pixels untouched
+void raster_blit_mask(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y,
+                      const struct raster_img *mask, lv_color_t color);
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zmk/display.h>
+
+#include "latency.h"
+#include "render.h"
+#include "render_stats.h"
+#include "trace.h"
+
+static render_cb_t render_cb;
+
+// Render request mailbox. Posted from any context, drained by the display work queue only.
+static atomic_t dirty_sections = ATOMIC_INIT(0);
+static atomic_t forced_sections = ATOMIC_INIT(0);
+
+static void render_work_handler(struct k_work *work);
+K_WORK_DELAYABLE_DEFINE(render_work, render_work_handler);
+
+static void render_work_handler(struct k_work *work) {
+    // render_now() calls in directly, only a scheduled frame is a wakeup
+    if (work != NULL) {
+        RENDER_STATS_INC(timer_wakeups);
+    }
+
+    // Requests posted after this point schedule the next frame
+    uint8_t sections = (uint8_t)atomic_clear(&dirty_sections);
+    uint8_t forced = (uint8_t)atomic_clear(&forced_sections);
+
+    sections |= forced;
+    if (sections != 0 && render_cb != NULL) {
+        GEM_TRACE_BEGIN("render", sections);
+        RENDER_STATS_INC(render_frames);
+        render_cb(sections, forced);
+        latency_rendered(sections);
+        GEM_TRACE_END("render", sections);
+    }
+}
+
+static void render_post(uint8_t sections) {
+    atomic_or(&dirty_sections, sections);
+
+    // Does nothing while a frame is pending, so a burst of events is drawn once
+    k_work_schedule_for_queue(zmk_display_work_q(), &render_work,
+                              K_MSEC(CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS));
+}
+
+void render_init(render_cb_t cb) { render_cb = cb; }
+
+void render_request(uint8_t sections) { render_post(sections); }
+
+void render_invalidate(uint8_t sections) {
+    atomic_or(&forced_sections, sections);
+    render_post(sections);
+}
+
+void render_now(void) {
+    k_work_cancel_delayable(&render_work);
+    render_work_handler(NULL);
+}
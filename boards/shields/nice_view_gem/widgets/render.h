@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+// Sections of the status screen that can be redrawn independently
+#define RENDER_SECTION_TOP BIT(0)
+#define RENDER_SECTION_MIDDLE BIT(1)
+#define RENDER_SECTION_BOTTOM BIT(2)
+#define RENDER_SECTION_ALL (RENDER_SECTION_TOP | RENDER_SECTION_MIDDLE | RENDER_SECTION_BOTTOM)
+
+// Draws the given sections, called from the display work queue. Sections in
+// `forced` were invalidated and must be redrawn even if their snapshot matches.
+typedef void (*render_cb_t)(uint8_t sections, uint8_t forced);
+
+void render_init(render_cb_t cb);
+
+// Mark sections dirty; they are drawn together in the next frame. Safe to call
+// from any context, including ISRs and timers.
+void render_request(uint8_t sections);
+
+// Like render_request, for changes that are not part of the section snapshots
+void render_invalidate(uint8_t sections);
+
+// Draw the pending sections now instead of at the next frame. Only from the
+// display work queue.
+void render_now(void);
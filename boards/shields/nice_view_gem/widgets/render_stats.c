@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "render_stats.h"
+
+#define RENDER_STATS_LOG_INTERVAL K_SECONDS(CONFIG_NICE_VIEW_GEM_RENDER_STATS_LOG_INTERVAL)
+
+struct render_stats render_stats;
+
+static void render_stats_log(struct k_work *work);
+K_WORK_DELAYABLE_DEFINE(render_stats_work, render_stats_log);
+
+void render_stats_behavior_press(uint32_t start_cycles) {
+    uint32_t cycles = k_cycle_get_32() - start_cycles;
+
+    render_stats.behavior_presses++;
+    render_stats.behavior_cycles_total += cycles;
+    render_stats.behavior_cycles_max = MAX(render_stats.behavior_cycles_max, cycles);
+}
+
+void render_stats_flush_frame(uint16_t lines, uint16_t lines_skipped, uint32_t bytes) {
+    render_stats.flush_frames++;
+    render_stats.flush_lines += lines;
+    render_stats.flush_lines_skipped += lines_skipped;
+    render_stats.flush_bytes += bytes;
+    render_stats.flush_bytes_max = MAX(render_stats.flush_bytes_max, bytes);
+}
+
+void render_stats_section_draw(uint8_t section, uint32_t start_cycles) {
+    uint32_t cycles = k_cycle_get_32() - start_cycles;
+    int i = find_lsb_set(section) - 1;
+
+    render_stats.section_draws[i]++;
+    render_stats.section_cycles_total[i] += cycles;
+    render_stats.section_cycles_max[i] = MAX(render_stats.section_cycles_max[i], cycles);
+}
+
+static void render_stats_log(struct k_work *work) {
+    render_stats.timer_wakeups++;
+
+    uint32_t performed = render_stats.redraws_performed;
+    uint32_t skipped = render_stats.redraws_skipped;
+    uint32_t total = performed + skipped;
+
+    LOG_INF("Redraws: %u performed, %u skipped (%u%% skipped) in %u frames", performed, skipped,
+            total ? skipped * 100 / total : 0, render_stats.render_frames);
+
+    static const char *const section_names[] = {"top", "middle", "bottom"};
+    for (int i = 0; i < RENDER_STATS_SECTIONS; i++) {
+        uint32_t draws = render_stats.section_draws[i];
+
+        if (draws > 0) {
+            LOG_INF("Draw %s: %u times, avg %u us, max %u us", section_names[i], draws,
+                    k_cyc_to_us_floor32(render_stats.section_cycles_total[i] / draws),
+                    k_cyc_to_us_floor32(render_stats.section_cycles_max[i]));
+        }
+    }
+
+    if (render_stats.behavior_presses > 0) {
+        LOG_INF("Behavior press: avg %u us, max %u us",
+                k_cyc_to_us_floor32(render_stats.behavior_cycles_total /
+                                    render_stats.behavior_presses),
+                k_cyc_to_us_floor32(render_stats.behavior_cycles_max));
+    }
+
+    if (render_stats.flush_frames > 0) {
+        uint32_t frames = render_stats.flush_frames;
+
+        LOG_INF("Flush: %u frames, avg %u lines / %u bytes per frame, max %u bytes, "
+                "%u unchanged lines skipped",
+                frames, render_stats.flush_lines / frames, render_stats.flush_bytes / frames,
+                render_stats.flush_bytes_max, render_stats.flush_lines_skipped);
+    }
+
+    if (render_stats.hidden_events_skipped > 0 || render_stats.hidden_refreshes_skipped > 0) {
+        LOG_INF("Hidden screens: %u status changes and %u refreshes not drawn",
+                render_stats.hidden_events_skipped, render_stats.hidden_refreshes_skipped);
+    }
+
+    if (render_stats.pomodoro_wakeups > 0) {
+        LOG_INF("Pomodoro: %u timer wakeups", render_stats.pomodoro_wakeups);
+    }
+
+    if (render_stats.pomodoro_updates_in_place > 0) {
+        LOG_INF("Pomodoro: %u in-place updates, %u digit cells drawn",
+                render_stats.pomodoro_updates_in_place, render_stats.pomodoro_cells_drawn);
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_TEXT_CACHE)
+    uint32_t hits = render_stats.text_cache_hits;
+    uint32_t misses = render_stats.text_cache_misses;
+
+    LOG_INF("Text cache: %u hits, %u misses (%u%% hits), %u evictions", hits, misses,
+            hits + misses ? hits * 100 / (hits + misses) : 0, render_stats.text_cache_evictions);
+#endif
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_SCREEN_CACHE)
+    LOG_INF("Screen cache: %u screens restored, %u drawn", render_stats.screen_cache_hits,
+            render_stats.screen_cache_misses);
+#endif
+
+    k_work_schedule(&render_stats_work, RENDER_STATS_LOG_INTERVAL);
+}
+
+static int render_stats_init(void) {
+    k_work_schedule(&render_stats_work, RENDER_STATS_LOG_INTERVAL);
+    return 0;
+}
+
+SYS_INIT(render_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
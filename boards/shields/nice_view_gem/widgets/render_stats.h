@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+// Sections timed by render_stats_section_draw, one per RENDER_SECTION_* bit
+#define RENDER_STATS_SECTIONS 3
+
+// Rendering counters, only collected with CONFIG_NICE_VIEW_GEM_RENDER_STATS
+struct render_stats {
+    uint32_t render_frames;
+    uint32_t redraws_performed;
+    uint32_t redraws_skipped;
+    uint32_t behavior_presses;
+    uint32_t behavior_cycles_total;
+    uint32_t behavior_cycles_max;
+    uint32_t text_cache_hits;
+    uint32_t text_cache_misses;
+    uint32_t text_cache_evictions;
+    uint32_t screen_cache_hits;
+    uint32_t screen_cache_misses;
+    uint32_t pomodoro_updates_in_place;
+    uint32_t pomodoro_cells_drawn;
+    uint32_t pomodoro_wakeups;
+    uint32_t timer_wakeups;
+    uint32_t hidden_events_skipped;
+    uint32_t hidden_refreshes_skipped;
+    uint32_t flush_frames;
+    uint32_t flush_lines;
+    uint32_t flush_lines_skipped;
+    uint32_t flush_bytes;
+    uint32_t flush_bytes_max;
+    uint32_t section_draws[RENDER_STATS_SECTIONS];
+    uint32_t section_cycles_total[RENDER_STATS_SECTIONS];
+    uint32_t section_cycles_max[RENDER_STATS_SECTIONS];
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_RENDER_STATS)
+extern struct render_stats render_stats;
+#define RENDER_STATS_INC(field) (render_stats.field++)
+
+// Record the time spent in a behavior's binding press since start_cycles
+void render_stats_behavior_press(uint32_t start_cycles);
+
+// Record the panel lines and SPI bytes sent for one frame
+void render_stats_flush_frame(uint16_t lines, uint16_t lines_skipped, uint32_t bytes);
+
+// Record the time spent drawing one RENDER_SECTION_* since start_cycles
+void render_stats_section_draw(uint8_t section, uint32_t start_cycles);
+#else
+#define RENDER_STATS_INC(field)
+
+static inline void render_stats_behavior_press(uint32_t start_cycles) {}
+static inline void render_stats_flush_frame(uint16_t lines, uint16_t lines_skipped,
+                                            uint32_t bytes) {}
+static inline void render_stats_section_draw(uint8_t section, uint32_t start_cycles) {}
+#endif
@@ -9,64 +9,81 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/events/endpoint_changed.h>
 #include <zmk/events/layer_state_changed.h>
 #include <zmk/events/usb_conn_state_changed.h>
+#include <zmk/events/wpm_state_changed.h>
 #include <zmk/battery.h>
 #include <zmk/ble.h>
 #include <zmk/display.h>
 #include <zmk/endpoints.h>
 #include <zmk/keymap.h>
 #include <zmk/usb.h>
+#include <zmk/wpm.h>
 
 #include "battery.h"
 #include "layer.h"
 #include "output.h"
 #include "pomodoro.h"
-#include "profile_viewer.h"
+#include "latency.h"
+#include "render.h"
+#include "render_stats.h"
 #include "screen.h"
+#include "screen_cache.h"
+#include "screen_registry.h"
 #include "screen_selector.h"
-
-#define NUM_SCREENS 2
+#include "trace.h"
+#include "wpm.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 static int current_screen = 0;
+static atomic_t pending_cycles = ATOMIC_INIT(0);
 
 /**
  * Draw buffers
  **/
 
-static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+static void init_top_layer(struct zmk_widget_screen *widget) {
+    lv_obj_t *canvas = lv_obj_get_child(widget->obj, 0);
     fill_background(canvas);
 
+    draw_output_static(canvas);
+    draw_battery_static(canvas);
+
+    save_static_layer(canvas, widget->top_layer);
+}
+
+static void draw_top(lv_obj_t *widget, const uint8_t *layer, const struct status_state *state) {
+    uint32_t start = k_cycle_get_32();
+    GEM_TRACE_BEGIN("draw_top", 0);
+    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+    fill_static_layer(canvas, layer);
+
     // Draw widgets
     draw_output_status(canvas, state);
     draw_battery_status(canvas, state);
 
-    // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    lv_obj_invalidate(canvas);
+    latency_drawn(RENDER_SECTION_TOP);
+    render_stats_section_draw(RENDER_SECTION_TOP, start);
+    GEM_TRACE_END("draw_top", 0);
 }
 
-static void draw_middle(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
+static void draw_middle(lv_obj_t *widget, const struct status_state *state) {
+    uint32_t start = k_cycle_get_32();
+    GEM_TRACE_BEGIN("draw_middle", current_screen);
     lv_obj_t *canvas = lv_obj_get_child(widget, 1);
     
     // Always redraw the canvas background first
     fill_background(canvas);
-    
-    switch (current_screen) {
-    case 0:
-        // Screen 1: Profile viewer
-        draw_profile_viewer_status(canvas, state);
-        break;
-    case 1:
-        // Screen 2: Pomodoro timer
-        pomodoro_tick();  // Update timer
-        draw_pomodoro(canvas);
-        break;
-    }
-    
-    rotate_canvas(canvas, cbuf);
+    gem_screen_get(current_screen)->draw(canvas, state);
+
+    lv_obj_invalidate(canvas);
+    latency_drawn(RENDER_SECTION_MIDDLE);
+    render_stats_section_draw(RENDER_SECTION_MIDDLE, start);
+    GEM_TRACE_END("draw_middle", current_screen);
 }
 
-static void draw_bottom(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
+static void draw_bottom(lv_obj_t *widget, const struct status_state *state) {
+    uint32_t start = k_cycle_get_32();
+    GEM_TRACE_BEGIN("draw_bottom", state->layer_index);
     lv_obj_t *canvas = lv_obj_get_child(widget, 2);
     fill_background(canvas);
 
@@ -74,8 +91,172 @@ static void draw_bottom(lv_obj_t *widget, lv_color_t cbuf[], const struct status
     draw_layer_status(canvas, state);
     draw_screen_selector(canvas, current_screen);
 
-    // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    lv_obj_invalidate(canvas);
+    latency_drawn(RENDER_SECTION_BOTTOM);
+    render_stats_section_draw(RENDER_SECTION_BOTTOM, start);
+    GEM_TRACE_END("draw_bottom", state->layer_index);
+}
+
+/**
+ * Section snapshots
+ **/
+
+static void snapshot_top(const struct status_state *state, struct top_snapshot *snap) {
+    memset(snap, 0, sizeof(*snap));
+    snap->battery = state->battery;
+    snap->charging = state->charging;
+    snap->transport = state->selected_endpoint.transport;
+    if (state->selected_endpoint.transport == ZMK_TRANSPORT_BLE) {
+        snap->active_profile_connected = state->active_profile_connected;
+        snap->active_profile_bonded = state->active_profile_bonded;
+    }
+}
+
+static void snapshot_middle(const struct status_state *state, struct middle_snapshot *snap) {
+    memset(snap, 0, sizeof(*snap));
+    snap->screen = current_screen;
+    // Screens without status inputs, like the pomodoro timer, are refreshed by their own timers
+    uint32_t inputs = gem_screen_get(current_screen)->inputs;
+    if (inputs & GEM_SCREEN_INPUT_PROFILES) {
+        snap->active_profile_index = state->active_profile_index;
+        for (int i = 0; i < 5; ++i) {
+            snap->profiles_connected |= state->profiles_connected[i] << i;
+            snap->profiles_bonded |= state->profiles_bonded[i] << i;
+        }
+    }
+    if (inputs & GEM_SCREEN_INPUT_WPM) {
+        snap->wpm = state->wpm;
+    }
+}
+
+static void snapshot_bottom(const struct status_state *state, struct bottom_snapshot *snap) {
+    memset(snap, 0, sizeof(*snap));
+    snap->screen = current_screen;
+    snap->layer_index = state->layer_index;
+    snap->layer_label = state->layer_label;
+}
+
+static void update_top(struct zmk_widget_screen *widget, bool force) {
+    struct top_snapshot snap;
+    snapshot_top(&widget->state, &snap);
+    if (section_needs_redraw(&widget->rendered_top, &snap, sizeof(snap), force)) {
+        draw_top(widget->obj, widget->top_layer, &widget->state);
+    }
+}
+
+// Screens whose drawing only depends on their snapshot and generation
+static bool middle_cacheable(const struct gem_screen *screen) {
+    return screen->tick == NULL || screen->generation != NULL;
+}
+
+static uint32_t middle_generation(const struct gem_screen *screen) {
+    return screen->generation != NULL ? screen->generation() : 0;
+}
+
+static bool update_middle(struct zmk_widget_screen *widget, bool force) {
+    struct middle_snapshot snap;
+    snapshot_middle(&widget->state, &snap);
+    if (!section_needs_redraw(&widget->rendered_middle, &snap, sizeof(snap), force)) {
+        return false;
+    }
+
+    // Read before drawing, so a change during the draw makes the snapshot stale
+    const struct gem_screen *screen = gem_screen_get(current_screen);
+    widget->middle_generation = middle_generation(screen);
+
+    lv_obj_t *canvas = lv_obj_get_child(widget->obj, 1);
+    if (!force && middle_cacheable(screen) &&
+        screen_cache_restore(canvas, &snap, widget->middle_generation)) {
+        lv_obj_invalidate(canvas);
+        latency_drawn(RENDER_SECTION_MIDDLE);
+        return true;
+    }
+
+    draw_middle(widget->obj, &widget->state);
+    return true;
+}
+
+// Keep the middle canvas of a screen that is cycled away from
+static void store_middle(struct zmk_widget_screen *widget, int index) {
+    const struct gem_screen *screen = gem_screen_get(index);
+    if (widget->rendered_middle.screen == index && middle_cacheable(screen)) {
+        screen_cache_store(lv_obj_get_child(widget->obj, 1), &widget->rendered_middle,
+                           widget->middle_generation);
+    }
+}
+
+static void update_bottom(struct zmk_widget_screen *widget, bool force) {
+    struct bottom_snapshot snap;
+    snapshot_bottom(&widget->state, &snap);
+    if (section_needs_redraw(&widget->rendered_bottom, &snap, sizeof(snap), force)) {
+        draw_bottom(widget->obj, &widget->state);
+    }
+}
+
+static void enter_screen(int index) {
+    const struct gem_screen *screen = gem_screen_get(index);
+    if (screen->enter != NULL) {
+        screen->enter();
+    }
+}
+
+static void leave_screen(int index) {
+    const struct gem_screen *screen = gem_screen_get(index);
+    if (screen->leave != NULL) {
+        screen->leave();
+    }
+}
+
+// Whether the shown screen displays one of the given inputs. Also read by the listeners'
+// get_state callbacks outside the display queue, where a cycle may still be pending.
+static bool shown_screen_uses(uint32_t inputs) {
+    return (gem_screen_get(current_screen)->inputs & inputs) != 0;
+}
+
+// RENDER_SECTION_MIDDLE if the shown screen displays one of the given inputs. Hidden screens
+// catch up with the change when they are cycled to, as that redraws them in full.
+static uint8_t middle_for_inputs(uint32_t inputs) {
+    if (shown_screen_uses(inputs)) {
+        return RENDER_SECTION_MIDDLE;
+    }
+    RENDER_STATS_INC(hidden_events_skipped);
+    return 0;
+}
+
+static void render_sections(uint8_t sections, uint8_t forced) {
+    // Screen cycles requested since the last frame
+    int previous_screen = current_screen;
+    current_screen = (current_screen + atomic_clear(&pending_cycles)) % gem_screen_count();
+    if (current_screen != previous_screen) {
+        leave_screen(previous_screen);
+        enter_screen(current_screen);
+        // Events queued for the screen cycled away from are not what the new one shows
+        latency_rendered(RENDER_SECTION_MIDDLE);
+    }
+
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        if (sections & RENDER_SECTION_TOP) {
+            update_top(widget, forced & RENDER_SECTION_TOP);
+        }
+        if (sections & RENDER_SECTION_MIDDLE) {
+            if (current_screen != previous_screen) {
+                store_middle(widget, previous_screen);
+            }
+            // Screen refreshes are not part of the snapshot, the screen updates itself in place
+            const struct gem_screen *screen = gem_screen_get(current_screen);
+            bool tick = (forced & RENDER_SECTION_MIDDLE) && screen->tick != NULL;
+            if (!update_middle(widget, false) && tick) {
+                widget->middle_generation = middle_generation(screen);
+                GEM_TRACE_BEGIN("screen_tick", current_screen);
+                screen->tick(lv_obj_get_child(widget->obj, 1));
+                GEM_TRACE_END("screen_tick", current_screen);
+            }
+        }
+        if (sections & RENDER_SECTION_BOTTOM) {
+            update_bottom(widget, forced & RENDER_SECTION_BOTTOM);
+        }
+    }
 }
 
 /**
@@ -89,23 +270,31 @@ static void set_battery_status(struct zmk_widget_screen *widget,
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
     widget->state.battery = state.level;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    render_request(RENDER_SECTION_TOP);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
+    GEM_TRACE_BEGIN("bat_set", state.level);
     struct zmk_widget_screen *widget;
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_battery_status(widget, state); }
+    GEM_TRACE_END("bat_set", state.level);
 }
 
 static struct battery_status_state battery_status_get_state(const zmk_event_t *eh) {
+    GEM_TRACE_BEGIN("bat_get", 0);
     const struct zmk_battery_state_changed *ev = as_zmk_battery_state_changed(eh);
 
-    return (struct battery_status_state){
+    struct battery_status_state state = {
         .level = (ev != NULL) ? ev->state_of_charge : zmk_battery_state_of_charge(),
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
         .usb_present = zmk_usb_is_powered(),
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
     };
+    if (eh != NULL) {
+        latency_event(RENDER_SECTION_TOP);
+    }
+    GEM_TRACE_END("bat_get", state.level);
+    return state;
 }
 
 ZMK_DISPLAY_WIDGET_LISTENER(widget_battery_status, struct battery_status_state,
@@ -124,20 +313,28 @@ static void set_layer_status(struct zmk_widget_screen *widget, struct layer_stat
     widget->state.layer_index = state.index;
     widget->state.layer_label = state.label;
 
-    draw_bottom(widget->obj, widget->cbuf3, &widget->state);
+    render_request(RENDER_SECTION_BOTTOM);
 }
 
 static void layer_status_update_cb(struct layer_status_state state) {
+    GEM_TRACE_BEGIN("layer_set", state.index);
     struct zmk_widget_screen *widget;
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_layer_status(widget, state); }
+    GEM_TRACE_END("layer_set", state.index);
 }
 
 static struct layer_status_state layer_status_get_state(const zmk_event_t *eh) {
+    GEM_TRACE_BEGIN("layer_get", 0);
     uint8_t index = zmk_keymap_highest_layer_active();
-    return (struct layer_status_state){
+    struct layer_status_state state = {
         .index = index, 
         .label = zmk_keymap_layer_name(zmk_keymap_layer_index_to_id(index))
     };
+    if (eh != NULL) {
+        latency_event(RENDER_SECTION_BOTTOM);
+    }
+    GEM_TRACE_END("layer_get", index);
+    return state;
 }
 
 ZMK_DISPLAY_WIDGET_LISTENER(widget_layer_status, struct layer_status_state, layer_status_update_cb,
@@ -160,17 +357,18 @@ static void set_output_status(struct zmk_widget_screen *widget,
         widget->state.profiles_bonded[i] = state->profiles_bonded[i];
     }
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
-    draw_middle(widget->obj, widget->cbuf2, &widget->state);
-    draw_bottom(widget->obj, widget->cbuf3, &widget->state);
+    render_request(RENDER_SECTION_TOP | middle_for_inputs(GEM_SCREEN_INPUT_PROFILES));
 }
 
 static void output_status_update_cb(struct output_status_state state) {
+    GEM_TRACE_BEGIN("output_set", state.selected_endpoint.transport);
     struct zmk_widget_screen *widget;
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_output_status(widget, &state); }
+    GEM_TRACE_END("output_set", state.selected_endpoint.transport);
 }
 
 static struct output_status_state output_status_get_state(const zmk_event_t *_eh) {
+    GEM_TRACE_BEGIN("output_get", 0);
     struct output_status_state state = {
         .selected_endpoint = zmk_endpoints_selected(),
         .active_profile_index = zmk_ble_active_profile_index(),
@@ -181,6 +379,12 @@ static struct output_status_state output_status_get_state(const zmk_event_t *_eh
         state.profiles_connected[i] = zmk_ble_profile_is_connected(i);
         state.profiles_bonded[i] = !zmk_ble_profile_is_open(i);
     }
+    if (_eh != NULL) {
+        // Same sections as set_output_status(), or the event waits for the next cycle
+        uint8_t middle = shown_screen_uses(GEM_SCREEN_INPUT_PROFILES) ? RENDER_SECTION_MIDDLE : 0;
+        latency_event(RENDER_SECTION_TOP | middle);
+    }
+    GEM_TRACE_END("output_get", state.selected_endpoint.transport);
     return state;
 }
 
@@ -195,33 +399,76 @@ ZMK_SUBSCRIPTION(widget_output_status, zmk_usb_conn_state_changed);
 ZMK_SUBSCRIPTION(widget_output_status, zmk_ble_active_profile_changed);
 #endif
 
+/**
+ * WPM status
+ **/
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_SCREEN)
+static void set_wpm_status(struct zmk_widget_screen *widget, struct wpm_status_state state) {
+    wpm_history_push(&widget->state.wpm, state.wpm);
+
+    // Samples keep coming while the screen is hidden, without waking the display queue
+    uint8_t sections = middle_for_inputs(GEM_SCREEN_INPUT_WPM);
+    if (sections != 0) {
+        render_request(sections);
+    }
+}
+
+static void wpm_status_update_cb(struct wpm_status_state state) {
+    GEM_TRACE_BEGIN("wpm_set", state.wpm);
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_wpm_status(widget, state); }
+    GEM_TRACE_END("wpm_set", state.wpm);
+}
+
+static struct wpm_status_state wpm_status_get_state(const zmk_event_t *eh) {
+    GEM_TRACE_BEGIN("wpm_get", 0);
+    struct wpm_status_state state = {.wpm = zmk_wpm_get_state()};
+    if (eh != NULL && shown_screen_uses(GEM_SCREEN_INPUT_WPM)) {
+        latency_event(RENDER_SECTION_MIDDLE);
+    }
+    GEM_TRACE_END("wpm_get", state.wpm);
+    return state;
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_wpm_status, struct wpm_status_state, wpm_status_update_cb,
+                            wpm_status_get_state)
+ZMK_SUBSCRIPTION(widget_wpm_status, zmk_wpm_state_changed);
+#endif
+
 /**
  * Screen cycling
+ *
+ * Called from behaviors and timers. Both only post to the render mailbox, the
+ * screen index and canvases are touched by the display work queue alone.
  **/
 
 void zmk_widget_screen_cycle(void) {
-    current_screen = (current_screen + 1) % NUM_SCREENS;
-    struct zmk_widget_screen *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
-        draw_middle(widget->obj, widget->cbuf2, &widget->state);
-        draw_bottom(widget->obj, widget->cbuf3, &widget->state);
-        // Force LVGL to refresh
-        lv_obj_t *middle_canvas = lv_obj_get_child(widget->obj, 1);
-        lv_obj_t *bottom_canvas = lv_obj_get_child(widget->obj, 2);
-        lv_obj_invalidate(middle_canvas);
-        lv_obj_invalidate(bottom_canvas);
+    atomic_inc(&pending_cycles);
+    render_request(RENDER_SECTION_MIDDLE | RENDER_SECTION_BOTTOM);
+}
+
+void zmk_widget_screen_refresh(const struct gem_screen *screen) {
+    // A screen that is cycled to in the meantime is drawn in full anyway
+    if (gem_screen_index(screen) == current_screen) {
+        render_invalidate(RENDER_SECTION_MIDDLE);
+    } else {
+        RENDER_STATS_INC(hidden_refreshes_skipped);
     }
 }
 
-void zmk_widget_screen_refresh(void) {
+/**
+ * Scripted status
+ **/
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_FRAME_CHECK)
+void zmk_widget_screen_set_state(const struct status_state *state) {
     struct zmk_widget_screen *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
-        draw_middle(widget->obj, widget->cbuf2, &widget->state);
-        // Force LVGL to refresh
-        lv_obj_t *middle_canvas = lv_obj_get_child(widget->obj, 1);
-        lv_obj_invalidate(middle_canvas);
-    }
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { widget->state = *state; }
+
+    render_request(RENDER_SECTION_ALL);
 }
+#endif
 
 /**
  * Initialization
@@ -233,26 +480,32 @@ int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
 
     lv_obj_t *top = lv_canvas_create(widget->obj);
     lv_obj_align(top, LV_ALIGN_TOP_RIGHT, 0, 0);
-    lv_canvas_set_buffer(top, widget->cbuf, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
+    init_canvas(top, widget->cbuf, EDGE_BUFFER_SIZE, BUFFER_SIZE);
+    init_top_layer(widget);
 
     lv_obj_t *middle = lv_canvas_create(widget->obj);
-    lv_obj_align(middle, LV_ALIGN_TOP_LEFT, 46, 0);  // Profiles/gem area
-    lv_canvas_set_buffer(middle, widget->cbuf2, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_align(middle, LV_ALIGN_TOP_LEFT, EDGE_BUFFER_SIZE, 0);  // Profiles/gem area
+    init_canvas(middle, widget->cbuf2, BUFFER_SIZE, BUFFER_SIZE);
 
     lv_obj_t *bottom = lv_canvas_create(widget->obj);
-    lv_obj_align(bottom, LV_ALIGN_TOP_LEFT, -22, 0);  // Layer + screen dots area
-    lv_canvas_set_buffer(bottom, widget->cbuf3, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_align(bottom, LV_ALIGN_TOP_LEFT, 0, 0);  // Layer + screen dots area
+    init_canvas(bottom, widget->cbuf3, EDGE_BUFFER_SIZE, BUFFER_SIZE);
 
     sys_slist_append(&widgets, &widget->node);
+    render_init(render_sections);
     widget_battery_status_init();
     widget_layer_status_init();
     widget_output_status_init();
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_SCREEN)
+    widget_wpm_status_init();
+#endif
     pomodoro_init();
+    enter_screen(current_screen);
 
     // Initial draw of all sections
-    draw_top(widget->obj, widget->cbuf, &widget->state);
-    draw_middle(widget->obj, widget->cbuf2, &widget->state);
-    draw_bottom(widget->obj, widget->cbuf3, &widget->state);
+    update_top(widget, true);
+    update_middle(widget, true);
+    update_bottom(widget, true);
 
     return 0;
 }
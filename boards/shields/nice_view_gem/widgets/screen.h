@@ -2,18 +2,54 @@
 
 #include <lvgl.h>
 #include <zephyr/kernel.h>
+#include "screen_registry.h"
 #include "util.h"
 
+// Fields each section displays, as of its last redraw
+struct top_snapshot {
+    uint8_t battery;
+    bool charging;
+    uint8_t transport;
+    bool active_profile_connected;
+    bool active_profile_bonded;
+};
+
+struct middle_snapshot {
+    uint8_t screen;
+    int8_t active_profile_index;
+    uint8_t profiles_connected;
+    uint8_t profiles_bonded;
+    struct wpm_history wpm;
+};
+
+struct bottom_snapshot {
+    uint8_t screen;
+    uint8_t layer_index;
+    const char *layer_label;
+};
+
 struct zmk_widget_screen {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[BUFFER_SIZE * BUFFER_SIZE];
-    lv_color_t cbuf2[BUFFER_SIZE * BUFFER_SIZE];
-    lv_color_t cbuf3[BUFFER_SIZE * BUFFER_SIZE];
+    uint8_t cbuf[CANVAS_BUF_SIZE(EDGE_BUFFER_SIZE, BUFFER_SIZE)];
+    uint8_t top_layer[CANVAS_LAYER_SIZE(EDGE_BUFFER_SIZE, BUFFER_SIZE)];
+    uint8_t cbuf2[CANVAS_BUF_SIZE(BUFFER_SIZE, BUFFER_SIZE)];
+    uint8_t cbuf3[CANVAS_BUF_SIZE(EDGE_BUFFER_SIZE, BUFFER_SIZE)];
     struct status_state state;
+    struct top_snapshot rendered_top;
+    struct middle_snapshot rendered_middle;
+    // Screen generation as of the last middle draw or tick
+    uint32_t middle_generation;
+    struct bottom_snapshot rendered_bottom;
 };
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent);
 lv_obj_t *zmk_widget_screen_obj(struct zmk_widget_screen *widget);
 void zmk_widget_screen_cycle(void);
-void zmk_widget_screen_refresh(void);
\ No newline at end of file
+// Update the given middle screen in place at the next frame, if it is shown. Safe to call
+// from any context.
+void zmk_widget_screen_refresh(const struct gem_screen *screen);
+
+// Replace the displayed status of every screen and request a redraw, for
+// scripted frame checks. Only from the display work queue.
+void zmk_widget_screen_set_state(const struct status_state *state);
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#include "render_stats.h"
+#include "screen_cache.h"
+
+// A rendered middle screen, without the canvas palette
+struct screen_snapshot {
+    bool valid;
+    uint32_t generation;
+    uint32_t last_used;
+    struct middle_snapshot snap;
+    uint8_t bits[CANVAS_LAYER_SIZE(BUFFER_SIZE, BUFFER_SIZE)];
+};
+
+static struct screen_snapshot snapshots[CONFIG_NICE_VIEW_GEM_SCREEN_CACHE_SIZE];
+static uint32_t use_counter;
+
+static struct screen_snapshot *find_snapshot(uint8_t screen) {
+    for (int i = 0; i < ARRAY_SIZE(snapshots); i++) {
+        if (snapshots[i].valid && snapshots[i].snap.screen == screen) {
+            return &snapshots[i];
+        }
+    }
+    return NULL;
+}
+
+static struct screen_snapshot *evict_snapshot(void) {
+    struct screen_snapshot *oldest = &snapshots[0];
+    for (int i = 1; i < ARRAY_SIZE(snapshots); i++) {
+        if (snapshots[i].last_used < oldest->last_used) {
+            oldest = &snapshots[i];
+        }
+    }
+    return oldest;
+}
+
+void screen_cache_store(lv_obj_t *canvas, const struct middle_snapshot *snap,
+                        uint32_t generation) {
+    struct screen_snapshot *entry = find_snapshot(snap->screen);
+    if (entry == NULL) {
+        entry = evict_snapshot();
+    }
+
+    save_static_layer(canvas, entry->bits);
+    entry->snap = *snap;
+    entry->generation = generation;
+    entry->last_used = ++use_counter;
+    entry->valid = true;
+}
+
+bool screen_cache_restore(lv_obj_t *canvas, const struct middle_snapshot *snap,
+                          uint32_t generation) {
+    struct screen_snapshot *entry = find_snapshot(snap->screen);
+    if (entry == NULL || entry->generation != generation ||
+        memcmp(&entry->snap, snap, sizeof(*snap)) != 0) {
+        RENDER_STATS_INC(screen_cache_misses);
+        return false;
+    }
+
+    RENDER_STATS_INC(screen_cache_hits);
+    fill_static_layer(canvas, entry->bits);
+    entry->last_used = ++use_counter;
+    return true;
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include "screen.h"
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_SCREEN_CACHE)
+// Keep the middle canvas as drawn for snap and the screen's generation, replacing the older
+// snapshot of the same screen or the least recently used one. Only from the display thread.
+void screen_cache_store(lv_obj_t *canvas, const struct middle_snapshot *snap,
+                        uint32_t generation);
+
+// Copy the snapshot of snap->screen back onto canvas if it was drawn for the same snapshot
+// and generation. Returns false when the screen has to be drawn.
+bool screen_cache_restore(lv_obj_t *canvas, const struct middle_snapshot *snap,
+                          uint32_t generation);
+#else
+static inline void screen_cache_store(lv_obj_t *canvas, const struct middle_snapshot *snap,
+                                      uint32_t generation) {}
+static inline bool screen_cache_restore(lv_obj_t *canvas, const struct middle_snapshot *snap,
+                                        uint32_t generation) {
+    return false;
+}
+#endif
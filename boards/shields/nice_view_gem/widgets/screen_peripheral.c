@@ -18,7 +18,11 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include "animation.h"
 #include "battery.h"
 #include "output.h"
+#include "latency.h"
+#include "render.h"
+#include "render_stats.h"
 #include "screen_peripheral.h"
+#include "trace.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 static lv_obj_t *animation_obj = NULL;
@@ -27,16 +31,50 @@ static lv_obj_t *animation_obj = NULL;
  * Draw buffers
  **/
 
-static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+static void init_top_layer(struct zmk_widget_screen *widget) {
+    lv_obj_t *canvas = lv_obj_get_child(widget->obj, 0);
     fill_background(canvas);
 
+    draw_output_static(canvas);
+    draw_battery_static(canvas);
+
+    save_static_layer(canvas, widget->top_layer);
+}
+
+static void draw_top(lv_obj_t *widget, const uint8_t *layer, const struct status_state *state) {
+    uint32_t start = k_cycle_get_32();
+    GEM_TRACE_BEGIN("draw_top", 0);
+    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+    fill_static_layer(canvas, layer);
+
     // Draw widgets
     draw_output_status(canvas, state);
     draw_battery_status(canvas, state);
 
-    // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    lv_obj_invalidate(canvas);
+    latency_drawn(RENDER_SECTION_TOP);
+    render_stats_section_draw(RENDER_SECTION_TOP, start);
+    GEM_TRACE_END("draw_top", 0);
+}
+
+static void update_top(struct zmk_widget_screen *widget, bool force) {
+    struct top_snapshot snap = {
+        .battery = widget->state.battery,
+        .charging = widget->state.charging,
+        .connected = widget->state.connected,
+    };
+    if (section_needs_redraw(&widget->rendered_top, &snap, sizeof(snap), force)) {
+        draw_top(widget->obj, widget->top_layer, &widget->state);
+    }
+}
+
+static void render_sections(uint8_t sections, uint8_t forced) {
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        if (sections & RENDER_SECTION_TOP) {
+            update_top(widget, forced & RENDER_SECTION_TOP);
+        }
+    }
 }
 
 static void draw_animation_screen(lv_obj_t *widget) {
@@ -63,23 +101,31 @@ static void set_battery_status(struct zmk_widget_screen *widget,
 
     widget->state.battery = state.level;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    render_request(RENDER_SECTION_TOP);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
+    GEM_TRACE_BEGIN("bat_set", state.level);
     struct zmk_widget_screen *widget;
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_battery_status(widget, state); }
+    GEM_TRACE_END("bat_set", state.level);
 }
 
 static struct battery_status_state battery_status_get_state(const zmk_event_t *eh) {
+    GEM_TRACE_BEGIN("bat_get", 0);
     const struct zmk_battery_state_changed *ev = as_zmk_battery_state_changed(eh);
 
-    return (struct battery_status_state){
+    struct battery_status_state state = {
         .level = (ev != NULL) ? ev->state_of_charge : zmk_battery_state_of_charge(),
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
         .usb_present = zmk_usb_is_powered(),
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
     };
+    if (eh != NULL) {
+        latency_event(RENDER_SECTION_TOP);
+    }
+    GEM_TRACE_END("bat_get", state.level);
+    return state;
 }
 
 ZMK_DISPLAY_WIDGET_LISTENER(widget_battery_status, struct battery_status_state,
@@ -95,19 +141,27 @@ ZMK_SUBSCRIPTION(widget_battery_status, zmk_usb_conn_state_changed);
  **/
 
 static struct peripheral_status_state get_state(const zmk_event_t *_eh) {
-    return (struct peripheral_status_state){.connected = zmk_split_bt_peripheral_is_connected()};
+    GEM_TRACE_BEGIN("periph_get", 0);
+    struct peripheral_status_state state = {.connected = zmk_split_bt_peripheral_is_connected()};
+    if (_eh != NULL) {
+        latency_event(RENDER_SECTION_TOP);
+    }
+    GEM_TRACE_END("periph_get", state.connected);
+    return state;
 }
 
 static void set_connection_status(struct zmk_widget_screen *widget,
                                   struct peripheral_status_state state) {
     widget->state.connected = state.connected;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    render_request(RENDER_SECTION_TOP);
 }
 
 static void output_status_update_cb(struct peripheral_status_state state) {
+    GEM_TRACE_BEGIN("periph_set", state.connected);
     struct zmk_widget_screen *widget;
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_connection_status(widget, state); }
+    GEM_TRACE_END("periph_set", state.connected);
 }
 
 ZMK_DISPLAY_WIDGET_LISTENER(widget_peripheral_status, struct peripheral_status_state,
@@ -140,6 +194,19 @@ static int activity_state_listener(const zmk_event_t *eh) {
 ZMK_LISTENER(widget_activity_status, activity_state_listener);
 ZMK_SUBSCRIPTION(widget_activity_status, zmk_activity_state_changed);
 
+/**
+ * Scripted status
+ **/
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_FRAME_CHECK)
+void zmk_widget_screen_set_state(const struct status_state *state) {
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { widget->state = *state; }
+
+    render_request(RENDER_SECTION_TOP);
+}
+#endif
+
 /**
  * Initialization
  **/
@@ -151,15 +218,17 @@ int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
     // Only one canvas for top status bar
     lv_obj_t *top = lv_canvas_create(widget->obj);
     lv_obj_align(top, LV_ALIGN_TOP_RIGHT, 0, 0);
-    lv_canvas_set_buffer(top, widget->cbuf, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
+    init_canvas(top, widget->cbuf, EDGE_BUFFER_SIZE, BUFFER_SIZE);
+    init_top_layer(widget);
 
     sys_slist_append(&widgets, &widget->node);
+    render_init(render_sections);
     widget_battery_status_init();
     widget_peripheral_status_init();
 
     // Draw animation and top bar
     draw_animation_screen(widget->obj);
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    update_top(widget, true);
 
     return 0;
 }
@@ -4,12 +4,25 @@
 #include <zephyr/kernel.h>
 #include "util.h"
 
+// Fields the top section displays, as of its last redraw
+struct top_snapshot {
+    uint8_t battery;
+    bool charging;
+    bool connected;
+};
+
 struct zmk_widget_screen {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[BUFFER_SIZE * BUFFER_SIZE];
+    uint8_t cbuf[CANVAS_BUF_SIZE(EDGE_BUFFER_SIZE, BUFFER_SIZE)];
+    uint8_t top_layer[CANVAS_LAYER_SIZE(EDGE_BUFFER_SIZE, BUFFER_SIZE)];
     struct status_state state;
+    struct top_snapshot rendered_top;
 };
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent);
-lv_obj_t *zmk_widget_screen_obj(struct zmk_widget_screen *widget);
\ No newline at end of file
+lv_obj_t *zmk_widget_screen_obj(struct zmk_widget_screen *widget);
+
+// Replace the displayed status of every screen and request a redraw, for
+// scripted frame checks. Only from the display work queue.
+void zmk_widget_screen_set_state(const struct status_state *state);
\ No newline at end of file
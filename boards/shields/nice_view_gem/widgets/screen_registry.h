@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include "util.h"
+
+// Status fields a middle screen shows. A change of one only redraws the middle section while
+// a screen with that input is shown.
+#define GEM_SCREEN_INPUT_PROFILES BIT(0)
+#define GEM_SCREEN_INPUT_WPM BIT(1)
+
+// A screen of the middle section, cycled with &scr_cyc
+struct gem_screen {
+    const char *name;
+    // Draw the whole screen on a cleared canvas
+    void (*draw)(lv_obj_t *canvas, const struct status_state *state);
+    // GEM_SCREEN_INPUT_* fields that draw reads
+    uint32_t inputs;
+    // Optional, update the shown screen in place after zmk_widget_screen_refresh()
+    void (*tick)(lv_obj_t *canvas);
+    // Optional for screens with a tick, a number that changes whenever the screen would draw
+    // differently. Screens with a tick but no generation are always redrawn when shown.
+    uint32_t (*generation)(void);
+    // Optional, called from the display work queue when the screen is shown and hidden
+    void (*enter)(void);
+    void (*leave)(void);
+};
+
+// Screens are listed in the order of their `order` argument, a two digit number. Any widget
+// can add one, the screen selector dots follow.
+#define GEM_SCREEN_DEFINE(id, order, ...)                                                          \
+    const STRUCT_SECTION_ITERABLE_NAMED(gem_screen, order##_##id, gem_screen_##id) = {          \
+        .name = #id, __VA_ARGS__}
+
+#define GEM_SCREEN_DECLARE(id) extern const struct gem_screen gem_screen_##id
+
+static inline int gem_screen_count(void) {
+    int count;
+    STRUCT_SECTION_COUNT(gem_screen, &count);
+    return count;
+}
+
+static inline const struct gem_screen *gem_screen_get(int index) {
+    struct gem_screen *screen;
+    STRUCT_SECTION_GET(gem_screen, index, &screen);
+    return screen;
+}
+
+static inline int gem_screen_index(const struct gem_screen *screen) {
+    return screen - gem_screen_get(0);
+}
@@ -1,31 +1,28 @@
 #include <zephyr/kernel.h>
+#include "raster.h"
+#include "screen_registry.h"
 #include "screen_selector.h"
 
-#define NUM_SCREENS 2
-
 void draw_screen_selector(lv_obj_t *canvas, int current_screen) {
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
 
     // Draw dots in bottom canvas (below layer text)
     int dot_size = 8;
     int dot_spacing = 14;
-    int total_width = NUM_SCREENS * dot_spacing - (dot_spacing - dot_size);
+    int num_screens = gem_screen_count();
+    int total_width = num_screens * dot_spacing - (dot_spacing - dot_size);
     int start_x = (68 - total_width) / 2;  // Center horizontally
     int y_pos = 5;  // Near top of canvas = lower on rotated screen
 
-    for (int i = 0; i < NUM_SCREENS; i++) {
+    for (int i = 0; i < num_screens; i++) {
         int x_pos = start_x + (i * dot_spacing);
         
         // Draw outer border
-        lv_canvas_draw_rect(canvas, x_pos, y_pos, dot_size, dot_size, &rect_white_dsc);
+        raster_rect(img, x_pos, y_pos, dot_size, dot_size, LVGL_FOREGROUND);
         
         // Fill with background color if not selected
         if (i != current_screen) {
-            lv_canvas_draw_rect(canvas, x_pos + 1, y_pos + 1, dot_size - 2, dot_size - 2, &rect_black_dsc);
+            raster_rect(img, x_pos + 1, y_pos + 1, dot_size - 2, dot_size - 2, LVGL_BACKGROUND);
         }
     }
 }
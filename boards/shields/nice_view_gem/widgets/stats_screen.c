@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zmk/display.h>
+
+#include "heap_stats.h"
+#include "render_stats.h"
+#include "screen.h"
+#include "stats_screen.h"
+
+#define STATS_INTERVAL_MS (CONFIG_NICE_VIEW_GEM_STATS_SCREEN_INTERVAL * MSEC_PER_SEC)
+
+// Seven lines of eight characters in the 8x8 font
+#define STATS_LINES 7
+#define STATS_LINE_CHARS 8
+#define STATS_LINE_PITCH 9
+#define STATS_X ((BUFFER_SIZE - STATS_LINE_CHARS * 8) / 2)
+#define STATS_Y ((BUFFER_SIZE - STATS_LINES * STATS_LINE_PITCH + 1) / 2)
+
+// Counter values at the last sample and the per minute rates since the one before
+static struct {
+    bool valid;
+    int64_t time;
+    uint32_t frames;
+    uint32_t wakeups;
+    uint32_t bytes;
+} last_sample;
+
+static struct {
+    bool valid;
+    uint32_t frames;
+    uint32_t wakeups;
+    uint32_t bytes;
+} rates;
+
+static void stats_refresh(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(stats_work, stats_refresh);
+
+static uint32_t per_minute(uint32_t delta, int64_t elapsed_ms) {
+    return (uint32_t)((uint64_t)delta * 60 * MSEC_PER_SEC / elapsed_ms);
+}
+
+static void stats_sample(void) {
+    int64_t now = k_uptime_get();
+    uint32_t frames = render_stats.render_frames;
+    uint32_t wakeups = render_stats.timer_wakeups;
+    uint32_t bytes = render_stats.flush_bytes;
+
+    if (last_sample.valid && now > last_sample.time) {
+        int64_t elapsed = now - last_sample.time;
+
+        rates.frames = per_minute(frames - last_sample.frames, elapsed);
+        rates.wakeups = per_minute(wakeups - last_sample.wakeups, elapsed);
+        rates.bytes = per_minute(bytes - last_sample.bytes, elapsed);
+        rates.valid = true;
+    }
+
+    last_sample.valid = true;
+    last_sample.time = now;
+    last_sample.frames = frames;
+    last_sample.wakeups = wakeups;
+    last_sample.bytes = bytes;
+}
+
+GEM_SCREEN_DECLARE(stats);
+
+static void stats_refresh(struct k_work *work) {
+    RENDER_STATS_INC(timer_wakeups);
+    stats_sample();
+    zmk_widget_screen_refresh(&gem_screen_stats);
+    k_work_schedule_for_queue(zmk_display_work_q(), &stats_work, K_MSEC(STATS_INTERVAL_MS));
+}
+
+static void stats_screen_enter(void) {
+    // Rates need two samples, the first refresh fills them in
+    rates.valid = false;
+    stats_sample();
+    k_work_schedule_for_queue(zmk_display_work_q(), &stats_work, K_MSEC(STATS_INTERVAL_MS));
+}
+
+static void stats_screen_leave(void) {
+    k_work_cancel_delayable(&stats_work);
+    last_sample.valid = false;
+}
+
+/**
+ * Formatting
+ **/
+
+// Four characters: plain below 10000, then thousands and millions
+static void format_count(char *buf, size_t len, uint32_t value) {
+    if (value < 10000) {
+        snprintf(buf, len, "%4u", value);
+    } else if (value < 1000000) {
+        snprintf(buf, len, "%3uK", value / 1000);
+    } else {
+        snprintf(buf, len, "%3uM", MIN(value / 1000000, 999));
+    }
+}
+
+// Three characters: microseconds below 1000, then milliseconds with the unit as the
+// decimal point ("2m1" is 2.1 ms)
+static void format_us(char *buf, size_t len, uint32_t us) {
+    if (us < 1000) {
+        snprintf(buf, len, "%3u", us);
+    } else if (us < 10000) {
+        snprintf(buf, len, "%um%u", us / 1000, us / 100 % 10);
+    } else if (us < 100000) {
+        snprintf(buf, len, "%2um", us / 1000);
+    } else {
+        snprintf(buf, len, "---");
+    }
+}
+
+static void format_rate(char *buf, size_t len, const char *label, uint32_t value) {
+    char count[5] = "   -";
+
+    if (rates.valid) {
+        format_count(count, sizeof(count), value);
+    }
+    snprintf(buf, len, "%s %s", label, count);
+}
+
+static void format_section(char *buf, size_t len, char label, int section) {
+    uint32_t draws = render_stats.section_draws[section];
+    char avg[4] = "  -", max[4] = "  -";
+
+    if (draws > 0) {
+        format_us(avg, sizeof(avg),
+                  k_cyc_to_us_floor32(render_stats.section_cycles_total[section] / draws));
+        format_us(max, sizeof(max), k_cyc_to_us_floor32(render_stats.section_cycles_max[section]));
+    }
+    snprintf(buf, len, "%c%s/%s", label, avg, max);
+}
+
+/**
+ * Drawing
+ **/
+
+void draw_stats_screen(lv_obj_t *canvas) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    char lines[STATS_LINES][STATS_LINE_CHARS + 1];
+    struct heap_stats heap;
+
+    heap_stats_get(&heap);
+
+    // Frames drawn, timer wakeups and panel bytes per minute
+    format_rate(lines[0], sizeof(lines[0]), "FRM", rates.frames);
+    format_rate(lines[1], sizeof(lines[1]), "WAK", rates.wakeups);
+    format_rate(lines[2], sizeof(lines[2]), "TX ", rates.bytes);
+    snprintf(lines[3], sizeof(lines[3]), "HEAP%3u%%",
+             (uint32_t)MIN(heap.used * 100 / CONFIG_LV_Z_MEM_POOL_SIZE, 999));
+
+    // Average and max draw time of each section
+    format_section(lines[4], sizeof(lines[4]), 'T', 0);
+    format_section(lines[5], sizeof(lines[5]), 'M', 1);
+    format_section(lines[6], sizeof(lines[6]), 'B', 2);
+
+    // Drawn without the text cache: the values change on every refresh and would only
+    // evict the sprites of the other screens
+    for (int i = 0; i < STATS_LINES; i++) {
+        draw_text_line(img, STATS_X, STATS_Y + i * STATS_LINE_PITCH, &lv_font_unscii_8, 0,
+                       lines[i], strlen(lines[i]), LVGL_FOREGROUND);
+    }
+}
+
+static void draw_stats_page(lv_obj_t *canvas, const struct status_state *state) {
+    draw_stats_screen(canvas);
+}
+
+// Every value may have changed, so refreshes redraw the whole page
+static void update_stats_page(lv_obj_t *canvas) {
+    fill_background(canvas);
+    draw_stats_screen(canvas);
+    lv_obj_invalidate(canvas);
+}
+
+GEM_SCREEN_DEFINE(stats, 30, .draw = draw_stats_page, .tick = update_stats_page,
+                  .enter = stats_screen_enter, .leave = stats_screen_leave);
@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include "util.h"
+
+// Render statistics page of the middle section. The page samples the statistics
+// periodically while it is shown, and not at all otherwise.
+void draw_stats_screen(lv_obj_t *canvas);
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#include "render_stats.h"
+#include "text_cache.h"
+
+static struct text_sprite sprites[CONFIG_NICE_VIEW_GEM_TEXT_CACHE_SIZE];
+static uint32_t use_counter;
+
+static struct text_sprite *find_sprite(const lv_font_t *font, lv_coord_t letter_space,
+                                       const char *txt) {
+    for (int i = 0; i < ARRAY_SIZE(sprites); i++) {
+        struct text_sprite *sprite = &sprites[i];
+        if (sprite->font == font && sprite->letter_space == letter_space &&
+            strcmp(sprite->text, txt) == 0) {
+            return sprite;
+        }
+    }
+    return NULL;
+}
+
+static struct text_sprite *evict_sprite(void) {
+    struct text_sprite *oldest = &sprites[0];
+    for (int i = 1; i < ARRAY_SIZE(sprites); i++) {
+        if (sprites[i].last_used < oldest->last_used) {
+            oldest = &sprites[i];
+        }
+    }
+
+    if (oldest->font != NULL) {
+        RENDER_STATS_INC(text_cache_evictions);
+    }
+    return oldest;
+}
+
+static void rasterize(struct text_sprite *sprite, const lv_font_t *font, lv_coord_t letter_space,
+                      const char *txt, size_t len, lv_coord_t line_w, lv_coord_t line_h) {
+    // Sprites are laid out like a canvas of the text's size, so the raster code can draw them
+    lv_img_dsc_t img = {
+        .header.cf = LV_IMG_CF_INDEXED_1BIT,
+        .header.w = line_h,
+        .header.h = line_w + 2 * TEXT_SPRITE_MARGIN,
+        .data = sprite->buf,
+    };
+    raster_clear(&img, lv_color_black());
+    draw_text_line(&img, TEXT_SPRITE_MARGIN, 0, font, letter_space, txt, len, lv_color_white());
+
+    sprite->font = font;
+    sprite->letter_space = letter_space;
+    sprite->line_w = line_w;
+    sprite->img.w = img.header.h;
+    sprite->img.h = img.header.w;
+    sprite->img.data = canvas_row(&img, 0);
+    memcpy(sprite->text, txt, len + 1);
+}
+
+const struct text_sprite *text_cache_get(const lv_font_t *font, lv_coord_t letter_space,
+                                         lv_coord_t max_w, const char *txt) {
+    struct text_sprite *sprite = find_sprite(font, letter_space, txt);
+    if (sprite != NULL) {
+        // Wider than max_w would wrap
+        if (sprite->line_w > max_w) {
+            return NULL;
+        }
+        RENDER_STATS_INC(text_cache_hits);
+        sprite->last_used = ++use_counter;
+        return sprite;
+    }
+
+    RENDER_STATS_INC(text_cache_misses);
+
+    size_t len = strlen(txt);
+    lv_coord_t line_h = lv_font_get_line_height(font);
+    if (len == 0 || len > TEXT_CACHE_MAX_LEN || line_h > TEXT_SPRITE_MAX_H ||
+        strchr(txt, '\n') != NULL) {
+        return NULL;
+    }
+
+    lv_coord_t line_w = lv_txt_get_width(txt, len, font, letter_space, LV_TEXT_FLAG_NONE);
+    if (line_w > max_w || line_w + 2 * TEXT_SPRITE_MARGIN > TEXT_SPRITE_MAX_W) {
+        return NULL;
+    }
+
+    sprite = evict_sprite();
+    rasterize(sprite, font, letter_space, txt, len, line_w, line_h);
+    sprite->last_used = ++use_counter;
+    return sprite;
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include "raster.h"
+
+// Longest string kept in the cache, in bytes
+#define TEXT_CACHE_MAX_LEN 15
+// Blank columns on each side of a sprite, for glyphs reaching past their advance
+#define TEXT_SPRITE_MARGIN 1
+#define TEXT_SPRITE_MAX_W (BUFFER_SIZE + 2 * TEXT_SPRITE_MARGIN)
+#define TEXT_SPRITE_MAX_H 24
+
+// A single line of text rasterized as a 1-bit mask
+struct text_sprite {
+    const lv_font_t *font;
+    lv_coord_t letter_space;
+    uint32_t last_used;
+    // Width of the line itself, without the margins
+    lv_coord_t line_w;
+    struct raster_img img;
+    char text[TEXT_CACHE_MAX_LEN + 1];
+    uint8_t buf[CANVAS_PALETTE_SIZE + CANVAS_LAYER_SIZE(TEXT_SPRITE_MAX_H, TEXT_SPRITE_MAX_W)];
+};
+
+// Sprite for txt, rasterizing it on a miss and evicting the least recently used entry.
+// Returns NULL for text that does not fit on one line of max_w or is too large to cache.
+// Only called from the display thread.
+const struct text_sprite *text_cache_get(const lv_font_t *font, lv_coord_t letter_space,
+                                         lv_coord_t max_w, const char *txt);
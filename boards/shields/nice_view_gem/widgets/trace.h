@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+// Render pipeline spans, emitted as tracing named events so they show up in
+// CTF traces. The first event argument tells the begin and end of a span
+// apart, the second carries a span specific value such as the section mask.
+// Without CONFIG_NICE_VIEW_GEM_TRACING they compile to nothing.
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_TRACING)
+#include <zephyr/tracing/tracing.h>
+
+#define GEM_TRACE_SPAN_BEGIN 1
+#define GEM_TRACE_SPAN_END 0
+
+// Names are kept under the 20 characters a CTF named event holds
+#define GEM_TRACE_BEGIN(name, arg) sys_trace_named_event("gem_" name, GEM_TRACE_SPAN_BEGIN, (arg))
+#define GEM_TRACE_END(name, arg) sys_trace_named_event("gem_" name, GEM_TRACE_SPAN_END, (arg))
+#else
+#define GEM_TRACE_BEGIN(name, arg)
+#define GEM_TRACE_END(name, arg)
+#endif
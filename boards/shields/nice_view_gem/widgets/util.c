@@ -1,6 +1,10 @@
 #include <zephyr/kernel.h>
 #include "util.h"
+#include "raster.h"
+#include "render_stats.h"
+#include "text_cache.h"
 #include <ctype.h>
+#include <string.h>
 
 void to_uppercase(char *str) {
     for (int i = 0; str[i] != '\0'; i++) {
@@ -8,26 +12,46 @@ void to_uppercase(char *str) {
     }
 }
 
-void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]) {
-    static lv_color_t cbuf_tmp[BUFFER_SIZE * BUFFER_SIZE];
-    memcpy(cbuf_tmp, cbuf, sizeof(cbuf_tmp));
+void init_canvas(lv_obj_t *canvas, uint8_t cbuf[], lv_coord_t w, lv_coord_t h) {
+    lv_canvas_set_buffer(canvas, cbuf, w, h, LV_IMG_CF_INDEXED_1BIT);
+    // Palette index == lv_color_t.full, so pixels can be written as raw bits
+    lv_canvas_set_palette(canvas, 0, lv_color_black());
+    lv_canvas_set_palette(canvas, 1, lv_color_white());
+}
+
+void fill_background(lv_obj_t *canvas) {
+    raster_clear(lv_canvas_get_img(canvas), LVGL_BACKGROUND);
+}
 
-    lv_img_dsc_t img;
-    img.data = (void *)cbuf_tmp;
-    img.header.cf = LV_IMG_CF_TRUE_COLOR;
-    img.header.w = BUFFER_SIZE;
-    img.header.h = BUFFER_SIZE;
+/**
+ * Static layers
+ *
+ * Labels and frames that never change are drawn once into a section's canvas
+ * and saved; each redraw then starts from a copy of them instead of a blank
+ * background.
+ **/
 
-    lv_canvas_fill_bg(canvas, LVGL_BACKGROUND, LV_OPA_COVER);
-    lv_canvas_transform(canvas, &img, 900, LV_IMG_ZOOM_NONE, -1, 0, BUFFER_SIZE / 2,
-                        BUFFER_SIZE / 2, false);
+void save_static_layer(lv_obj_t *canvas, uint8_t layer[]) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+
+    memcpy(layer, canvas_row(img, 0), CANVAS_LAYER_SIZE(img->header.w, img->header.h));
 }
 
-void fill_background(lv_obj_t *canvas) {
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
+void fill_static_layer(lv_obj_t *canvas, const uint8_t layer[]) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
 
-    lv_canvas_draw_rect(canvas, 0, 0, BUFFER_SIZE, BUFFER_SIZE, &rect_black_dsc);
+    memcpy(canvas_row(img, 0), layer, CANVAS_LAYER_SIZE(img->header.w, img->header.h));
+}
+
+bool section_needs_redraw(void *rendered, const void *snapshot, size_t size, bool force) {
+    if (!force && memcmp(rendered, snapshot, size) == 0) {
+        RENDER_STATS_INC(redraws_skipped);
+        return false;
+    }
+
+    memcpy(rendered, snapshot, size);
+    RENDER_STATS_INC(redraws_performed);
+    return true;
 }
 
 void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
@@ -53,4 +77,179 @@ void init_arc_dsc(lv_draw_arc_dsc_t *arc_dsc, lv_color_t color, uint8_t width) {
     lv_draw_arc_dsc_init(arc_dsc);
     arc_dsc->color = color;
     arc_dsc->width = width;
-}
\ No newline at end of file
+}
+
+/**
+ * Drawing
+ *
+ * Sections are laid out in portrait coordinates (x runs along the 68 px panel
+ * height, y runs across the section) and written straight into landscape
+ * canvases, so no rotation pass is needed after drawing.
+ **/
+
+void canvas_invalidate_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w,
+                            lv_coord_t h) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    lv_area_t area;
+
+    // Portrait x runs down the canvas rows, portrait y right to left across them
+    lv_obj_get_coords(canvas, &area);
+    area.x1 += img->header.w - y - h;
+    area.y1 += x;
+    area.x2 = area.x1 + h - 1;
+    area.y2 = area.y1 + w - 1;
+    lv_obj_invalidate_area(canvas, &area);
+}
+
+void canvas_draw_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      lv_draw_rect_dsc_t *draw_dsc) {
+    raster_rect(lv_canvas_get_img(canvas), x, y, w, h, draw_dsc->bg_color);
+}
+
+static bool arc_contains(int32_t dx, int32_t dy, int32_t start_angle, int32_t span) {
+    if (span >= 360) {
+        return true;
+    }
+
+    int32_t end_angle = start_angle + span;
+    int32_t sx = lv_trigo_sin(start_angle + 90), sy = lv_trigo_sin(start_angle);
+    int32_t ex = lv_trigo_sin(end_angle + 90), ey = lv_trigo_sin(end_angle);
+
+    // Positive cross product means clockwise on screen (y points down)
+    bool after_start = sx * dy - sy * dx >= 0;
+    bool before_end = dx * ey - dy * ex >= 0;
+
+    if (span <= 180) {
+        return after_start && before_end;
+    }
+    return after_start || before_end;
+}
+
+void canvas_draw_arc(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t r,
+                     int32_t start_angle, int32_t end_angle, lv_draw_arc_dsc_t *draw_dsc) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+
+    if (start_angle == end_angle) {
+        return;
+    }
+
+    int32_t span = end_angle - start_angle;
+    if (span < 0 || span > 360) {
+        span = ((span % 360) + 360) % 360;
+    }
+    start_angle = ((start_angle % 360) + 360) % 360;
+
+    // Full circles are drawn as spans
+    if (span >= 360) {
+        raster_ring(img, x, y, r, draw_dsc->width, draw_dsc->color);
+        return;
+    }
+
+    // Compare doubled distances against pixel edges, as LVGL's circle masks do
+    int32_t outer = (2 * r + 1) * (2 * r + 1);
+    int32_t inner_r = r - draw_dsc->width;
+    int32_t inner = inner_r > 0 ? (2 * inner_r + 1) * (2 * inner_r + 1) : 0;
+
+    for (int32_t dy = -r; dy <= r; dy++) {
+        for (int32_t dx = -r; dx <= r; dx++) {
+            int32_t d = 4 * (dx * dx + dy * dy);
+            if (d >= outer || d < inner) {
+                continue;
+            }
+            if (arc_contains(dx, dy, start_angle, span)) {
+                raster_px(img, x + dx, y + dy, draw_dsc->color);
+            }
+        }
+    }
+}
+
+static void draw_glyph(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, const lv_font_t *font,
+                       uint32_t letter, uint32_t letter_next, lv_color_t color) {
+    lv_font_glyph_dsc_t g;
+
+    if (!lv_font_get_glyph_dsc(font, &g, letter, letter_next) || g.box_w == 0) {
+        return;
+    }
+
+    const uint8_t *bitmap = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+    if (bitmap == NULL) {
+        return;
+    }
+
+    // Only 1, 2, 4 and 8 bpp fonts are used; they never straddle a byte
+    uint8_t max = (1 << g.bpp) - 1;
+    lv_coord_t gx = x + g.ofs_x;
+    lv_coord_t gy = y + (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+    uint32_t bit = 0;
+
+    for (lv_coord_t row = 0; row < g.box_h; row++) {
+        for (lv_coord_t col = 0; col < g.box_w; col++, bit += g.bpp) {
+            uint8_t value = (bitmap[bit >> 3] >> (8 - g.bpp - (bit & 7))) & max;
+            // 1-bit panels keep a pixel once its coverage passes 50%
+            if (value * 2 > max) {
+                raster_px(img, gx + col, gy + row, color);
+            }
+        }
+    }
+}
+
+void draw_text_line(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, const lv_font_t *font,
+                    lv_coord_t letter_space, const char *txt, uint32_t len, lv_color_t color) {
+    uint32_t i = 0;
+    while (i < len) {
+        uint32_t letter = _lv_txt_encoded_next(txt, &i);
+        uint32_t next = i;
+        uint32_t letter_next = next < len ? _lv_txt_encoded_next(txt, &next) : 0;
+
+        draw_glyph(img, x, y, font, letter, letter_next, color);
+        lv_coord_t letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+        if (letter_w > 0) {
+            x += letter_w + letter_space;
+        }
+    }
+}
+
+static lv_coord_t align_offset(lv_text_align_t align, lv_coord_t max_w, lv_coord_t line_w) {
+    if (align == LV_TEXT_ALIGN_CENTER) {
+        return (max_w - line_w) / 2;
+    } else if (align == LV_TEXT_ALIGN_RIGHT) {
+        return max_w - line_w;
+    }
+    return 0;
+}
+
+void canvas_draw_text(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t max_w,
+                      lv_draw_label_dsc_t *draw_dsc, const char *txt) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    const lv_font_t *font = draw_dsc->font;
+    lv_coord_t line_height = lv_font_get_line_height(font) + draw_dsc->line_space;
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_TEXT_CACHE)
+    // Single lines are blitted from the sprite cache, skipping layout and glyph decoding
+    const struct text_sprite *sprite =
+        draw_dsc->flag == LV_TEXT_FLAG_NONE
+            ? text_cache_get(font, draw_dsc->letter_space, max_w, txt)
+            : NULL;
+    if (sprite != NULL) {
+        lv_coord_t pos_x = x + align_offset(draw_dsc->align, max_w, sprite->line_w);
+        raster_blit_mask(img, pos_x - TEXT_SPRITE_MARGIN, y, &sprite->img, draw_dsc->color);
+        return;
+    }
+#endif
+
+    while (*txt != '\0') {
+        uint32_t len = _lv_txt_get_next_line(txt, font, draw_dsc->letter_space, max_w, NULL,
+                                             draw_dsc->flag);
+        if (len == 0) {
+            break;
+        }
+
+        lv_coord_t line_w =
+            lv_txt_get_width(txt, len, font, draw_dsc->letter_space, draw_dsc->flag);
+        lv_coord_t pos_x = x + align_offset(draw_dsc->align, max_w, line_w);
+        draw_text_line(img, pos_x, y, font, draw_dsc->letter_space, txt, len, draw_dsc->color);
+
+        txt += len;
+        y += line_height;
+    }
+}
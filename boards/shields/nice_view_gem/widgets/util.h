@@ -7,6 +7,15 @@
 #define SCREEN_HEIGHT 160
 
 #define BUFFER_SIZE 68
+// Visible width of the top and bottom strips on each side of the middle section
+#define EDGE_BUFFER_SIZE 46
+
+// Canvases are packed 1 bit per pixel behind a two entry palette
+#define CANVAS_PALETTE_SIZE (2 * sizeof(lv_color32_t))
+#define CANVAS_STRIDE(w) (((w) + 7) >> 3)
+#define CANVAS_BUF_SIZE(w, h) LV_CANVAS_BUF_SIZE_INDEXED_1BIT(w, h)
+// Pixel bits of a canvas without the palette, used for retained static layers
+#define CANVAS_LAYER_SIZE(w, h) (CANVAS_STRIDE(w) * (h))
 #define BUFFER_OFFSET_MIDDLE -44
 #define BUFFER_OFFSET_BOTTOM -129
 
@@ -15,6 +24,17 @@
 #define LVGL_FOREGROUND                                                                            \
     IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_white() : lv_color_black()
 
+// Samples shown by the WPM graph
+#define WPM_HISTORY_LEN 10
+
+// Ring of the last WPM samples, the oldest at head, with their running min and max
+struct wpm_history {
+    uint8_t samples[WPM_HISTORY_LEN];
+    uint8_t head;
+    uint8_t min;
+    uint8_t max;
+};
+
 struct status_state {
     uint8_t battery;
     bool charging;
@@ -27,17 +47,38 @@ struct status_state {
     bool profiles_bonded[5];
     uint8_t layer_index;
     const char *layer_label;
-    uint8_t wpm[10];
+    struct wpm_history wpm;
 #else
     bool connected;
 #endif
 };
 
+static inline uint8_t *canvas_row(const lv_img_dsc_t *img, lv_coord_t row) {
+    return (uint8_t *)img->data + CANVAS_PALETTE_SIZE + row * CANVAS_STRIDE(img->header.w);
+}
+
 void to_uppercase(char *str);
-void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]);
+void init_canvas(lv_obj_t *canvas, uint8_t cbuf[], lv_coord_t w, lv_coord_t h);
 void fill_background(lv_obj_t *canvas);
+void save_static_layer(lv_obj_t *canvas, uint8_t layer[]);
+void fill_static_layer(lv_obj_t *canvas, const uint8_t layer[]);
+bool section_needs_redraw(void *rendered, const void *snapshot, size_t size, bool force);
 void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color);
 void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width);
 void init_arc_dsc(lv_draw_arc_dsc_t *arc_dsc, lv_color_t color, uint8_t width);
 void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
-                    lv_text_align_t align);
\ No newline at end of file
+                    lv_text_align_t align);
+
+// Invalidate only the canvas area under a rect in portrait coordinates
+void canvas_invalidate_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w,
+                            lv_coord_t h);
+
+void canvas_draw_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      lv_draw_rect_dsc_t *draw_dsc);
+void canvas_draw_arc(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t r,
+                     int32_t start_angle, int32_t end_angle, lv_draw_arc_dsc_t *draw_dsc);
+// Draw len bytes of txt as one line, without wrapping or alignment
+void draw_text_line(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, const lv_font_t *font,
+                    lv_coord_t letter_space, const char *txt, uint32_t len, lv_color_t color);
+void canvas_draw_text(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t max_w,
+                      lv_draw_label_dsc_t *draw_dsc, const char *txt);
\ No newline at end of file
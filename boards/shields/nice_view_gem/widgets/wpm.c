@@ -1,70 +1,99 @@
-#include <math.h>
 #include <zephyr/kernel.h>
 #include "wpm.h"
+#include "raster.h"
+#include "screen_registry.h"
 #include "../assets/custom_fonts.h"
 
-LV_IMG_DECLARE(gauge);
-LV_IMG_DECLARE(grid);
+RASTER_IMG_DECLARE(gauge_canvas);
+RASTER_IMG_DECLARE(grid_canvas);
 
-static void draw_gauge(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
+// Needle pivot and length, the radius in 1/256 px (18 * sqrt(2))
+#define NEEDLE_CENTER_X 33
+#define NEEDLE_CENTER_Y 23
+#define NEEDLE_OFFSET_Q8 (13 << 8)
+#define NEEDLE_RADIUS_Q8 6517
 
-    lv_canvas_draw_img(canvas, 16, 44 + BUFFER_OFFSET_MIDDLE, &gauge, &img_dsc);
+#define GRAPH_BASELINE_Y 53
+#define GRAPH_HEIGHT 32
+
+/**
+ * History
+ **/
+
+static void rescan_history(struct wpm_history *history) {
+    history->min = history->samples[0];
+    history->max = history->samples[0];
+    for (int i = 1; i < WPM_HISTORY_LEN; i++) {
+        history->min = MIN(history->min, history->samples[i]);
+        history->max = MAX(history->max, history->samples[i]);
+    }
+}
+
+void wpm_history_push(struct wpm_history *history, uint8_t wpm) {
+    uint8_t evicted = history->samples[history->head];
+    history->samples[history->head] = wpm;
+    history->head = (history->head + 1) % WPM_HISTORY_LEN;
+
+    // Only a dropped extreme needs a look at the other samples
+    if ((evicted == history->max && wpm < evicted) ||
+        (evicted == history->min && wpm > evicted)) {
+        rescan_history(history);
+        return;
+    }
+    history->min = MIN(history->min, wpm);
+    history->max = MAX(history->max, wpm);
+}
+
+/**
+ * Drawing
+ **/
+
+static uint8_t latest_wpm(const struct status_state *state) {
+    return wpm_history_at(&state->wpm, WPM_HISTORY_LEN - 1);
+}
+
+static void draw_gauge(const lv_img_dsc_t *img) {
+    raster_blit(img, 16, 0, &gauge_canvas);
 }
 
-static void draw_needle(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_line_dsc_t line_dsc;
-    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 1);
+// Point at radius_q8 from the pivot, truncated towards it
+static lv_point_t needle_point(int32_t radius_q8, int32_t sine, int32_t cosine) {
+    lv_point_t point = {
+        .x = NEEDLE_CENTER_X + radius_q8 * cosine / (LV_TRIGO_SIN_MAX << 8),
+        .y = NEEDLE_CENTER_Y + radius_q8 * sine / (LV_TRIGO_SIN_MAX << 8),
+    };
+    return point;
+}
 
-    int centerX = 33;
-    int centerY = 67 + BUFFER_OFFSET_MIDDLE;
-    int offset = 13;
-    int value = state->wpm[9];
+static void draw_needle(const lv_img_dsc_t *img, const struct status_state *state) {
+    int value = latest_wpm(state);
 
 #if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE)
-    float max = CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX;
+    int max = CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX;
 #else
-    float max = 0;
-    for (int i = 0; i < 10; i++) {
-        if (state->wpm[i] > max) {
-            max = state->wpm[i];
-        }
-    }
+    int max = state->wpm.max;
 #endif
     if (max == 0)
         max = 100;
-    if (value < 0)
-        value = 0;
     if (value > max)
         value = max;
 
-    float radius = 25.45585;
-    float angleDeg = 225 + ((float)value / max) * 90;
-    float angleRad = angleDeg * (3.14159 / 180.0f);
+    // Sweep a quarter turn from the lower left, in whole degrees of LVGL's sine table
+    int16_t angle = 225 + value * 90 / max;
+    int32_t sine = lv_trigo_sin(angle);
+    int32_t cosine = lv_trigo_sin(angle + 90);
 
-    int needleStartX = centerX + (int)(offset * cos(angleRad));
-    int needleStartY = centerY + (int)(offset * sin(angleRad));
-    int needleEndX = centerX + (int)(radius * cos(angleRad));
-    int needleEndY = centerY + (int)(radius * sin(angleRad));
-
-    lv_point_t points[2] = {{needleStartX, needleStartY}, {needleEndX, needleEndY}};
-    lv_canvas_draw_line(canvas, points, 2, &line_dsc);
+    lv_point_t start = needle_point(NEEDLE_OFFSET_Q8, sine, cosine);
+    lv_point_t end = needle_point(NEEDLE_RADIUS_Q8, sine, cosine);
+    raster_line(img, start.x, start.y, end.x, end.y, 1, LVGL_FOREGROUND);
 }
 
-static void draw_grid(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 0, 65 + BUFFER_OFFSET_MIDDLE, &grid, &img_dsc);
+static void draw_grid(const lv_img_dsc_t *img) {
+    raster_blit(img, 0, 21, &grid_canvas);
 }
 
-static void draw_graph(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_line_dsc_t line_dsc;
-    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 2);
-    lv_point_t points[10];
-
-    int baselineY = 97 + BUFFER_OFFSET_MIDDLE;
+static void draw_graph(const lv_img_dsc_t *img, const struct status_state *state) {
+    lv_point_t points[WPM_HISTORY_LEN];
 
 #if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE)
     int max = CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX;
@@ -72,60 +101,53 @@ static void draw_graph(lv_obj_t *canvas, const struct status_state *state) {
         max = 100;
     }
 
-    int value = 0;
-    for (int i = 0; i < 10; i++) {
-        value = state->wpm[i];
-        if (value > max) {
-            value = max;
-        }
-        points[i].x = 0 + i * 7.4;
-        points[i].y = baselineY - (value * 32 / max);
+    for (int i = 0; i < WPM_HISTORY_LEN; i++) {
+        int value = MIN(wpm_history_at(&state->wpm, i), max);
+        points[i].x = i * 37 / 5;
+        points[i].y = GRAPH_BASELINE_Y - value * GRAPH_HEIGHT / max;
     }
 #else
-    int max = 0;
-    int min = 256;
-
-    for (int i = 0; i < 10; i++) {
-        if (state->wpm[i] > max) {
-            max = state->wpm[i];
-        }
-        if (state->wpm[i] < min) {
-            min = state->wpm[i];
-        }
-    }
-
-    int range = max - min;
+    int min = state->wpm.min;
+    int range = state->wpm.max - min;
     if (range == 0) {
         range = 1;
     }
 
-    for (int i = 0; i < 10; i++) {
-        points[i].x = 0 + i * 7.4;
-        points[i].y = baselineY - (state->wpm[i] - min) * 32 / range;
+    for (int i = 0; i < WPM_HISTORY_LEN; i++) {
+        points[i].x = i * 37 / 5;
+        int value = wpm_history_at(&state->wpm, i) - min;
+        points[i].y = GRAPH_BASELINE_Y - value * GRAPH_HEIGHT / range;
     }
 #endif
 
-    lv_canvas_draw_line(canvas, points, 10, &line_dsc);
+    for (int i = 1; i < WPM_HISTORY_LEN; i++) {
+        raster_line(img, points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, 2,
+                    LVGL_FOREGROUND);
+    }
 }
 
 static void draw_label(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_label_dsc_t label_left_dsc;
     init_label_dsc(&label_left_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 101 + BUFFER_OFFSET_MIDDLE, 25, &label_left_dsc, "WPM");
+    canvas_draw_text(canvas, 0, 57, 25, &label_left_dsc, "WPM");
 
     lv_draw_label_dsc_t label_dsc_wpm;
     init_label_dsc(&label_dsc_wpm, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_RIGHT);
 
     char wpm_text[6] = {};
 
-    snprintf(wpm_text, sizeof(wpm_text), "%d", state->wpm[9]);
-    lv_canvas_draw_text(canvas, 26, 101 + BUFFER_OFFSET_MIDDLE, 42, &label_dsc_wpm, wpm_text);
+    snprintf(wpm_text, sizeof(wpm_text), "%d", latest_wpm(state));
+    canvas_draw_text(canvas, 26, 57, 42, &label_dsc_wpm, wpm_text);
 }
 
 void draw_wpm_status(lv_obj_t *canvas, const struct status_state *state) {
-    draw_gauge(canvas, state);
-    draw_needle(canvas, state);
-    draw_grid(canvas);
-    draw_graph(canvas, state);
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+
+    draw_gauge(img);
+    draw_needle(img, state);
+    draw_grid(img);
+    draw_graph(img, state);
     draw_label(canvas, state);
-}
\ No newline at end of file
+}
+
+GEM_SCREEN_DEFINE(wpm, 25, .draw = draw_wpm_status, .inputs = GEM_SCREEN_INPUT_WPM);
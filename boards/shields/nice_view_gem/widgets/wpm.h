@@ -1,10 +1,21 @@
 #pragma once
 
 #include <lvgl.h>
+#include "screen_registry.h"
 #include "util.h"
 
 struct wpm_status_state {
     uint8_t wpm;
 };
 
-void draw_wpm_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
+// Sample i of the history, 0 being the oldest and WPM_HISTORY_LEN - 1 the latest
+static inline uint8_t wpm_history_at(const struct wpm_history *history, int i) {
+    return history->samples[(history->head + i) % WPM_HISTORY_LEN];
+}
+
+// Replace the oldest sample, keeping min and max up to date
+void wpm_history_push(struct wpm_history *history, uint8_t wpm);
+
+void draw_wpm_status(lv_obj_t *canvas, const struct status_state *state);
+
+GEM_SCREEN_DECLARE(wpm);